@@ -66,6 +66,7 @@
 #include "interface.h"
 #include "scroller.h"
 #include "sources.h"
+#include "highlight.h"
 #include "tgdb.h"
 #include "kui.h"
 #include "kui_term.h"
@@ -80,6 +81,7 @@
 #include "ibuf.h"
 #include "usage.h"
 #include "sys_util.h"
+#include "event_loop.h"
 
 /* --------- */
 /* Constants */
@@ -106,6 +108,7 @@ static int tty_fd = -1;         /* File descriptor for process being debugged */
 static pty_pair_ptr pty_pair;
 
 static char *debugger_path = NULL;  /* Path to debugger to use */
+static enum tgdb_protocol debugger_protocol = TGDB_PROTOCOL_ANNOTATE_TWO;
 
 struct kui_manager *kui_ctx = NULL; /* The key input package */
 
@@ -137,6 +140,41 @@ int kui_input_acceptable = 1;
 
 int resize_pipe[2] = { -1, -1 };
 
+/* The most program output that is read before other input is looked at */
+#define CHILD_INPUT_MAX 65536
+
+/* The most readline output that is read at once */
+#define READLINE_INPUT_MAX 1024
+
+/* Program output is read into this buffer, in as few reads as possible */
+static char child_buf[CHILD_INPUT_MAX + 1];
+
+/* GDB and readline output are read into these. Like child_buf, each is
+ * reused for every read from its descriptor, with room for a NUL. */
+static char gdb_buf[GDB_MAXBUF + 1];
+static char readline_buf[READLINE_INPUT_MAX + 1];
+
+/* Counts the lines of program output shown, to enforce outputlimit */
+static struct {
+    long long start;            /* When the current second started, in
+                                 * event_loop_now milliseconds */
+    int lines;                  /* Lines shown since start */
+    int skipped;                /* Lines not shown since start */
+    int partial;                /* The last line skipped has not ended */
+} child_rate;
+
+/* Readable when the highlighting thread has lines ready, or -1 */
+static int highlight_fd = -1;
+
+/* Waits for input and timers, and calls the handlers in main_loop */
+static struct event_loop *loop;
+
+/* Set while the key timer runs, see update_key_timer */
+static int key_timer_set = 0;
+
+/* The kui's chars read when the key timer was started */
+static unsigned long key_timer_chars_read = 0;
+
 /* Readline interface */
 static struct rline *rline;
 
@@ -675,12 +713,13 @@ static char *version_info(void)
 static void parse_long_options(int *argc, char ***argv)
 {
     int c, option_index = 0, n = 1;
-    const char *args = "d:hv";
+    const char *args = "d:hmv";
 
 #ifdef HAVE_GETOPT_H
     static struct option long_options[] = {
         {"version", 0, 0, 0},
         {"help", 0, 0, 0},
+        {"mi", 0, 0, 0},
         {0, 0, 0, 0}
     };
 #endif
@@ -707,6 +746,10 @@ static void parse_long_options(int *argc, char ***argv)
                     case 1:
                         usage();
                         exit(0);
+                    case 2:
+                        debugger_protocol = TGDB_PROTOCOL_GDBMI;
+                        n++;
+                        break;
                     default:
                         break;
                 }
@@ -727,6 +770,10 @@ static void parse_long_options(int *argc, char ***argv)
             case 'h':
                 usage();
                 exit(0);
+            case 'm':
+                debugger_protocol = TGDB_PROTOCOL_GDBMI;
+                n++;
+                break;
             default:
                 break;
         }
@@ -772,7 +819,8 @@ static int start_gdb(int argc, char *argv[])
 {
     tgdb_request_ptr request_ptr;
 
-    tgdb = tgdb_initialize(debugger_path, argc, argv, &gdb_fd, &tty_fd);
+    tgdb = tgdb_initialize(debugger_path, argc, argv, &gdb_fd, &tty_fd,
+            debugger_protocol);
     if (tgdb == NULL)
         return -1;
 
@@ -812,7 +860,8 @@ static void send_key(int focus, char key)
 
 /* user_input: This function will get a key from the user and process it.
  *
- *  Returns:  -1 on error, 0 on success
+ *  Returns:  -1 on error, 0 on success, 1 if the kui needs more input
+ *            to decide which key the user typed
  */
 static int user_input(void)
 {
@@ -839,6 +888,9 @@ static int user_input(void)
         return -1;
     }
 
+    if (key == KUI_WOULD_BLOCK)
+        return 1;
+
     val = if_input(key);
 
     if (val == -1) {
@@ -870,6 +922,35 @@ static int user_input(void)
     return 0;
 }
 
+static int key_timeout(int fd, void *data);
+
+/* update_key_timer: Starts the key timer when the kui starts waiting for the
+ * -----------------  rest of a sequence, and stops it when it stops waiting.
+ *                    Each char typed while waiting starts the wait again.
+ *
+ *   restart: 1 if keys were decided since the timer was started, so the
+ *            kui may be waiting on a new sequence.
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+static int update_key_timer(int restart)
+{
+    int ms = kui_manager_get_wait_ms(kui_ctx);
+    unsigned long chars_read = kui_manager_get_chars_read(kui_ctx);
+
+    if (ms == -1) {
+        key_timer_set = 0;
+        return event_loop_set_timer(loop, -1, key_timeout, NULL);
+    }
+
+    if (key_timer_set && !restart && chars_read == key_timer_chars_read)
+        return 0;
+
+    key_timer_set = 1;
+    key_timer_chars_read = chars_read;
+    return event_loop_set_timer(loop, ms, key_timeout, NULL);
+}
+
 /**
  * This will usually process all the input that the KUI has.
  *
@@ -879,25 +960,50 @@ static int user_input(void)
  * this loop can return before all the KUI's data has been used, in order to
  * give the main loop a chance to run a GDB command.
  *
+ * It also returns when the keys typed so far are the start of a longer
+ * sequence. The rest is read when more input arrives, or the key timer
+ * expires.
+ *
  * \return
  * 0 on success or -1 on error
  */
 static int user_input_loop()
 {
+    int result, keys = 0;
+
     do {
         /* There are reasons that CGDB should wait to get more info from the kui.
          * See the documentation for kui_input_acceptable */
         if (!kui_input_acceptable)
-            return 0;
+            break;
 
-        if (user_input() == -1) {
+        result = user_input();
+        if (result == -1) {
             logger_write_pos(logger, __FILE__, __LINE__,
                     "user_input_loop failed");
             return -1;
         }
+
+        if (result == 1)
+            break;
+
+        keys++;
     } while (kui_manager_cangetkey(kui_ctx));
 
-    return 0;
+    return update_key_timer(keys > 0);
+}
+
+/* key_timeout: The kui waited long enough for the rest of a sequence,
+ * ------------ the keys typed so far are taken as they are.
+ */
+static int key_timeout(int fd, void *data)
+{
+    key_timer_set = 0;
+
+    if (kui_manager_timeout(kui_ctx) == -1)
+        return -1;
+
+    return user_input_loop();
 }
 
 static void process_commands(struct tgdb *tgdb)
@@ -906,7 +1012,7 @@ static void process_commands(struct tgdb *tgdb)
 
     while ((item = tgdb_get_response(tgdb)) != NULL) {
         switch (item->header) {
-                /* This updates all the breakpoints */
+                /* This updates the breakpoints that changed */
             case TGDB_UPDATE_BREAKPOINTS:
             {
                 struct sviewer *sview = if_get_sview();
@@ -915,8 +1021,8 @@ static void process_commands(struct tgdb *tgdb)
                         item->choice.update_breakpoints.breakpoint_list;
                 tgdb_list_iterator *iterator;
                 struct tgdb_breakpoint *tb;
+                int changed = 0;
 
-                source_clear_breaks(if_get_sview());
                 iterator = tgdb_list_get_first(list);
 
                 while (iterator) {
@@ -926,15 +1032,20 @@ static void process_commands(struct tgdb *tgdb)
 
                     file = tb->file;
 
-                    if (tb->enabled)
-                        source_enable_break(sview, file, tb->line);
+                    if (tb->change == TGDB_BREAKPOINT_REMOVED)
+                        changed |= source_clear_break(sview, file, tb->line);
+                    else if (tb->enabled)
+                        changed |= source_enable_break(sview, file, tb->line);
                     else
-                        source_disable_break(sview, file, tb->line);
+                        changed |= source_disable_break(sview, file,
+                                tb->line);
 
                     iterator = tgdb_list_next(iterator);
                 }
 
-                if_show_file(NULL, 0);
+                /* Only redraw when the displayed file has changed */
+                if (changed)
+                    if_show_file(NULL, 0);
                 break;
             }
 
@@ -1091,27 +1202,52 @@ does_request_require_console_update(struct tgdb_request *request, int *update)
     return 0;
 }
 
+/* child_flush_skipped: Tells the user how much program output was skipped.
+ * --------------------
+ */
+static void child_flush_skipped(void)
+{
+    char msg[64];
+
+    if (child_rate.skipped == 0)
+        return;
+
+    snprintf(msg, sizeof (msg), "[%d lines skipped]\n", child_rate.skipped);
+    child_rate.skipped = 0;
+    if_tty_print(msg);
+}
+
+/* child_skipped_timeout: Reports the skipped program output at the end of
+ * ---------------------- the second, when the program went quiet.
+ */
+static int child_skipped_timeout(int fd, void *data)
+{
+    child_flush_skipped();
+
+    return 0;
+}
+
 /* gdb_input: Recieves data from tgdb:
  *
  *  Returns:  -1 on error, 0 on success
  */
 static int gdb_input()
 {
-    char *buf = malloc(GDB_MAXBUF + 1);
     int size;
     int is_finished;
 
     /* Read from GDB */
-    size = tgdb_process(tgdb, buf, GDB_MAXBUF, &is_finished);
+    size = tgdb_process(tgdb, gdb_buf, GDB_MAXBUF, &is_finished);
     if (size == -1) {
         logger_write_pos(logger, __FILE__, __LINE__,
                 "tgdb_recv_debugger_data error");
-        free(buf);
-        buf = NULL;
         return -1;
     }
 
-    buf[size] = 0;
+    gdb_buf[size] = 0;
+
+    /* Say how much program output was skipped before GDB continues */
+    child_flush_skipped();
 
     process_commands(tgdb);
 
@@ -1120,11 +1256,8 @@ static int gdb_input()
      * when displaying the filedlg. If it does get called, then the 
      * gdb window gets displayed when the filedlg is up
      */
-    if (strlen(buf) > 0)
-        if_print(buf);
-
-    free(buf);
-    buf = NULL;
+    if (strlen(gdb_buf) > 0)
+        if_print(gdb_buf);
 
     /* Check to see if GDB is ready to recieve another command. If it is, then
      * readline should redisplay what it currently contains. There are 2 special
@@ -1187,8 +1320,6 @@ static int gdb_input()
 
 static int readline_input()
 {
-    const int MAX = 1024;
-    char *buf = malloc(MAX + 1);
     int size;
 
     int masterfd = pty_pair_get_masterfd(pty_pair);
@@ -1199,15 +1330,13 @@ static int readline_input()
         return -1;
     }
 
-    size = read(masterfd, buf, MAX);
+    size = read(masterfd, readline_buf, READLINE_INPUT_MAX);
     if (size == -1) {
         logger_write_pos(logger, __FILE__, __LINE__, "read error");
-        free(buf);
-        buf = NULL;
         return -1;
     }
 
-    buf[size] = 0;
+    readline_buf[size] = 0;
 
     /* Display GDB output 
      * The strlen check is here so that if_print does not get called
@@ -1215,37 +1344,108 @@ static int readline_input()
      * gdb window gets displayed when the filedlg is up
      */
     if (size > 0)
-        if_print(buf);
+        if_print(readline_buf);
 
-    free(buf);
-    buf = NULL;
     return 0;
 }
 
+/* child_output: Displays output from the child application.
+ * -------------
+ *
+ * At most outputlimit lines are shown each second, the rest are counted and
+ * reported by child_flush_skipped.
+ *
+ *   buf:  The output, NUL terminated
+ */
+static void child_output(char *buf)
+{
+    int limit = cgdbrc_get(CGDBRC_OUTPUTLIMIT)->variant.int_val;
+    long long now;
+    long elapsed;
+    char *p = buf, *nl;
+    char c;
+
+    if (limit == 0) {
+        child_flush_skipped();
+        if_tty_print(buf);
+        return;
+    }
+
+    /* A new second, start counting again */
+    now = event_loop_now();
+    elapsed = now - child_rate.start;
+    if (elapsed >= 1000) {
+        child_flush_skipped();
+        child_rate.start = now;
+        child_rate.lines = 0;
+        child_rate.partial = 0;
+        elapsed = 0;
+    }
+
+    /* Find where the lines that may be shown end */
+    while (child_rate.lines < limit && (nl = strchr(p, '\n')) != NULL) {
+        child_rate.lines++;
+        p = nl + 1;
+    }
+
+    if (child_rate.lines < limit) {
+        if_tty_print(buf);
+        return;
+    }
+
+    /* Show up to the last allowed line, and count the ones after it */
+    c = *p;
+    *p = 0;
+    if (p != buf)
+        if_tty_print(buf);
+    *p = c;
+
+    /* A line is counted where it starts, it may end in a later read */
+    while (*p) {
+        if (!child_rate.partial)
+            child_rate.skipped++;
+
+        if ((nl = strchr(p, '\n')) == NULL) {
+            child_rate.partial = 1;
+            break;
+        }
+
+        child_rate.partial = 0;
+        p = nl + 1;
+    }
+
+    /* Report the skipped lines at the end of the second, even when no
+     * more output arrives */
+    if (child_rate.skipped > 0)
+        event_loop_set_timer(loop, 1000 - elapsed, child_skipped_timeout,
+                NULL);
+}
+
 /* child_input: Recieves data from the child application:
  *
  *  Returns:  -1 on error, 0 on success
  */
 static int child_input()
 {
-    char *buf = malloc(GDB_MAXBUF + 1);
-    int size;
+    int size = 0, result;
 
-    /* Read from GDB */
-    size = tgdb_recv_inferior_data(tgdb, buf, GDB_MAXBUF);
-    if (size == -1) {
-        logger_write_pos(logger, __FILE__, __LINE__,
-                "tgdb_recv_inferior_data error ");
-        free(buf);
-        buf = NULL;
-        return -1;
-    }
-    buf[size] = 0;
+    /* Read everything that is ready, up to the size of the buffer */
+    do {
+        result = tgdb_recv_inferior_data(tgdb, child_buf + size,
+                CHILD_INPUT_MAX - size);
+        if (result == -1) {
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "tgdb_recv_inferior_data error ");
+            return -1;
+        }
+        size += result;
+    } while (result > 0 && size < CHILD_INPUT_MAX &&
+            io_data_ready(tty_fd, 0) > 0);
+
+    child_buf[size] = 0;
 
     /* Display CHILD output */
-    if_tty_print(buf);
-    free(buf);
-    buf = NULL;
+    child_output(child_buf);
     return 0;
 }
 
@@ -1279,10 +1479,94 @@ static int cgdb_resize_term(int fd)
     return 0;
 }
 
+/* The handlers main_loop calls when a descriptor has input. */
+
+/* Input received through the pty:  Handle it 
+ * Wrote to masterfd, now slavefd is ready, tell readline */
+static int readline_slave_ready(int fd, void *data)
+{
+    rline_rl_callback_read_char(rline);
+    return 0;
+}
+
+/* Input received through the pty:  Handle it
+ * Readline read from slavefd, and it wrote to the masterfd. */
+static int readline_master_ready(int fd, void *data)
+{
+    return readline_input();
+}
+
+/* Input received:  Handle it */
+static int stdin_ready(int fd, void *data)
+{
+    int val = user_input_loop();
+
+    /* The below condition happens on cygwin when user types ctrl-z
+     * select returns (when it shouldn't) with the value of 1. the
+     * user input loop gets called, the kui gets called and does a
+     * non blocking read which returns EAGAIN. The kui then passes
+     * the -1 up the stack with out making any more system calls. */
+    if (val == -1 && errno == EAGAIN)
+        return 1;
+
+    return val;
+}
+
+/* child's ouptut -> stdout
+ * Returning 1 is important I think. It allows all of the child
+ * output to get written to stdout before tgdb's next command.
+ * This is because sometimes they are both ready.
+ */
+static int tty_ready(int fd, void *data)
+{
+    if (child_input() == -1)
+        return -1;
+
+    return 1;
+}
+
+/* gdb's output -> stdout */
+static int gdb_ready(int fd, void *data)
+{
+    if (gdb_input() == -1)
+        return -1;
+
+    /* When the file dialog is opened, the user input is blocked, 
+     * until GDB returns all the files that should be displayed,
+     * and the file dialog can open, and be prepared to receive 
+     * input. So, if we are in the file dialog, and are no longer
+     * waiting for the gdb command, then read the input.
+     */
+    if (kui_manager_cangetkey(kui_ctx))
+        user_input_loop();
+
+    return 0;
+}
+
+/* A resize signal occured */
+static int resize_ready(int fd, void *data)
+{
+    return cgdb_resize_term(fd);
+}
+
+/* Highlighted source lines are ready, show them in colour */
+static int highlight_ready(int fd, void *data)
+{
+    if (highlight_worker_collect() > 0)
+        if_draw();
+
+    return 0;
+}
+
+/* The frame rate allows the next terminal update. The update itself is
+ * done by if_update at the top of main_loop. */
+static int redraw_timeout(int fd, void *data)
+{
+    return 0;
+}
+
 static int main_loop(void)
 {
-    fd_set rset;
-    int max;
     int masterfd, slavefd;
 
     masterfd = pty_pair_get_masterfd(pty_pair);
@@ -1299,11 +1583,28 @@ static int main_loop(void)
         return -1;
     }
 
-    max = (gdb_fd > STDIN_FILENO) ? gdb_fd : STDIN_FILENO;
-    max = (max > tty_fd) ? max : tty_fd;
-    max = (max > resize_pipe[0]) ? max : resize_pipe[0];
-    max = (max > slavefd) ? max : slavefd;
-    max = (max > masterfd) ? max : masterfd;
+    loop = event_loop_create();
+    if (!loop) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "event_loop_create error");
+        return -1;
+    }
+
+    /* When several descriptors have input, the handlers are called in
+     * the order they are added here. */
+    if (event_loop_add(loop, slavefd, readline_slave_ready, NULL) == -1 ||
+            event_loop_add(loop, masterfd, readline_master_ready, NULL) == -1
+            || event_loop_add(loop, STDIN_FILENO, stdin_ready, NULL) == -1
+            || event_loop_add(loop, tty_fd, tty_ready, NULL) == -1
+            || event_loop_add(loop, gdb_fd, gdb_ready, NULL) == -1
+            || event_loop_add(loop, resize_pipe[0], resize_ready, NULL) == -1
+            || (highlight_fd != -1 && event_loop_add(loop, highlight_fd,
+                            highlight_ready, NULL) == -1)) {
+        logger_write_pos(logger, __FILE__, __LINE__, "event_loop_add error");
+        event_loop_destroy(loop);
+        loop = NULL;
+        return -1;
+    }
 
     /* Main (infinite) loop:
      *   Sits and waits for input on either stdin (user input) or the
@@ -1312,100 +1613,35 @@ static int main_loop(void)
      *   This will result in calls to the curses interface, typically. */
 
     for (;;) {
-        /* Reset the fd_set, and watch for input from GDB or stdin */
-        FD_ZERO(&rset);
-        FD_SET(STDIN_FILENO, &rset);
-        FD_SET(gdb_fd, &rset);
-        FD_SET(tty_fd, &rset);
-        FD_SET(resize_pipe[0], &rset);
+        /* Draw everything that changed during the last iteration in one
+         * terminal update. When the frame rate does not allow an update
+         * yet, wake up when it does. */
+        if (event_loop_set_timer(loop, if_update(), redraw_timeout,
+                        NULL) == -1)
+            break;
 
         /* No readline activity allowed while displaying tab completion */
-        if (!is_tab_completing) {
-            FD_SET(slavefd, &rset);
-            FD_SET(masterfd, &rset);
-        }
+        if (event_loop_enable(loop, slavefd, !is_tab_completing) == -1 ||
+                event_loop_enable(loop, masterfd, !is_tab_completing) == -1)
+            break;
 
         /* Before waits for any input, check if gdb process is terminated.
          * If it is, handle it here because the gdb_fd can have nothing
          * to read. This happens on mac OSX */
         if (tgdb_has_sigchld_recv(tgdb)) {
-            if (gdb_input() == -1) {
-                return -1;
-            }
-        }
-
-        /* Wait for input */
-        if (select(max + 1, &rset, NULL, NULL, NULL) == -1) {
-            if (errno == EINTR)
-                continue;
-            else {
-                logger_write_pos(logger, __FILE__, __LINE__,
-                        "select failed: %s", strerror(errno));
-                return -1;
-            }
-        }
-
-        /* Input received through the pty:  Handle it 
-         * Wrote to masterfd, now slavefd is ready, tell readline */
-        if (FD_ISSET(slavefd, &rset))
-            rline_rl_callback_read_char(rline);
-
-        /* Input received through the pty:  Handle it
-         * Readline read from slavefd, and it wrote to the masterfd. 
-         */
-        if (FD_ISSET(masterfd, &rset))
-            if (readline_input() == -1)
-                return -1;
-
-        /* Input received:  Handle it */
-        if (FD_ISSET(STDIN_FILENO, &rset)) {
-            int val = user_input_loop();
-
-            /* The below condition happens on cygwin when user types ctrl-z
-             * select returns (when it shouldn't) with the value of 1. the
-             * user input loop gets called, the kui gets called and does a
-             * non blocking read which returns EAGAIN. The kui then passes
-             * the -1 up the stack with out making any more system calls. */
-            if (val == -1 && errno == EAGAIN)
-                continue;
-            else if (val == -1)
-                return -1;
-        }
-
-        /* child's ouptut -> stdout
-         * The continue is important I think. It allows all of the child
-         * output to get written to stdout before tgdb's next command.
-         * This is because sometimes they are both ready.
-         */
-        if (FD_ISSET(tty_fd, &rset)) {
-            if (child_input() == -1)
-                return -1;
-            continue;
+            if (gdb_input() == -1)
+                break;
         }
 
-        /* gdb's output -> stdout */
-        if (FD_ISSET(gdb_fd, &rset)) {
-            if (gdb_input() == -1) {
-                return -1;
-            }
+        /* Wait for input or a timer, and handle it */
+        if (event_loop_run_once(loop) == -1)
+            break;
+    }
 
-            /* When the file dialog is opened, the user input is blocked, 
-             * until GDB returns all the files that should be displayed,
-             * and the file dialog can open, and be prepared to receive 
-             * input. So, if we are in the file dialog, and are no longer
-             * waiting for the gdb command, then read the input.
-             */
-            if (kui_manager_cangetkey(kui_ctx)) {
-                user_input_loop();
-            }
-        }
+    event_loop_destroy(loop);
+    loop = NULL;
 
-        /* A resize signal occured */
-        if (FD_ISSET(resize_pipe[0], &rset))
-            if (cgdb_resize_term(resize_pipe[0]) == -1)
-                return -1;
-    }
-    return 0;
+    return -1;
 }
 
 /* ----------------- */
@@ -1421,6 +1657,8 @@ void cleanup()
 
     ibuf_free(current_line);
 
+    highlight_worker_stop();
+
     /* Cleanly scroll the screen up for a prompt */
     scrl(1);
     move(LINES - 1, 0);
@@ -1721,6 +1959,10 @@ int main(int argc, char *argv[])
         exit(-1);
     }
 
+    /* Highlight source files without blocking the main loop. If the
+     * thread can not be started, they are highlighted when displayed. */
+    highlight_fd = highlight_worker_start();
+
     {
         char config_file[FSUTIL_PATH_MAX];
         FILE *config;
@@ -52,6 +52,11 @@ static int command_set_timeoutlen(int value);
 static int command_set_ttimeout(int value);
 static int command_set_ttimeoutlen(int value);
 static int command_set_winminheight(int value);
+static int command_set_sourcecachesize(int value);
+static int command_set_framerate(int value);
+static int command_set_scrollbackbuffersize(int value);
+static int command_set_outputlimit(int value);
+static int command_set_pipelinedepth(int value);
 static int command_set_syntax_type(const char *value);
 static int command_set_stc(int value);
 static int cgdbrc_set_val(struct cgdbrc_config_option config_option);
@@ -64,8 +69,13 @@ static struct cgdbrc_config_option cgdbrc_config_options[CGDBRC_WRAPSCAN + 1] =
     {CGDBRC_ARROWSTYLE, {ARROWSTYLE_SHORT}},
     {CGDBRC_AUTOSOURCERELOAD, {1}},
     {CGDBRC_CGDB_MODE_KEY, {CGDB_KEY_ESC}},
+    {CGDBRC_FRAMERATE, {60}},
     {CGDBRC_IGNORECASE, {0}},
+    {CGDBRC_OUTPUTLIMIT, {0}},
+    {CGDBRC_PIPELINEDEPTH, {TGDB_DEFAULT_PIPELINE_DEPTH}},
+    {CGDBRC_SCROLLBACK_BUFFER_SIZE, {10000}},
     {CGDBRC_SHOWTGDBCOMMANDS, {0}},
+    {CGDBRC_SOURCECACHESIZE, {64}},
     {CGDBRC_SYNTAX, {TOKENIZER_LANGUAGE_UNKNOWN}},
     {CGDBRC_TABSTOP, {8}},
     {CGDBRC_TIMEOUT, {1}},
@@ -104,13 +114,30 @@ static struct ConfigVariable {
     {
     "cgdbmodekey", "cgdbmodekey", CONFIG_TYPE_FUNC_STRING,
                 command_set_cgdb_mode_key},
+            /* framerate */
+    {
+    "framerate", "fr", CONFIG_TYPE_FUNC_INT, &command_set_framerate},
             /* ignorecase */
     {
     "ignorecase", "ic", CONFIG_TYPE_BOOL,
                 &cgdbrc_config_options[CGDBRC_IGNORECASE].variant.int_val},
+            /* outputlimit */
+    {
+    "outputlimit", "ol", CONFIG_TYPE_FUNC_INT, &command_set_outputlimit},
+            /* pipelinedepth */
+    {
+    "pipelinedepth", "pd", CONFIG_TYPE_FUNC_INT, &command_set_pipelinedepth},
+            /* scrollbackbuffersize */
+    {
+    "scrollbackbuffersize", "sbbs", CONFIG_TYPE_FUNC_INT,
+                &command_set_scrollbackbuffersize},
             /* showtgdbcommands */
     {
     "showtgdbcommands", "stc", CONFIG_TYPE_FUNC_BOOL, &command_set_stc},
+            /* sourcecachesize */
+    {
+    "sourcecachesize", "scs", CONFIG_TYPE_FUNC_INT,
+                &command_set_sourcecachesize},
             /* syntax */
     {
     "syntax", "syn", CONFIG_TYPE_FUNC_STRING, command_set_syntax_type},
@@ -347,6 +374,77 @@ static int command_set_winminheight(int value)
     return cgdbrc_set_val(option);
 }
 
+static int command_set_sourcecachesize(int value)
+{
+    struct cgdbrc_config_option option;
+
+    /* The cache size is in megabytes, 0 means there is no limit */
+    if (value < 0)
+        return 1;
+
+    option.option_kind = CGDBRC_SOURCECACHESIZE;
+    option.variant.int_val = value;
+    return cgdbrc_set_val(option);
+}
+
+static int command_set_framerate(int value)
+{
+    struct cgdbrc_config_option option;
+
+    /* The number of screen updates per second, 0 means there is no limit */
+    if (value < 0)
+        return 1;
+
+    option.option_kind = CGDBRC_FRAMERATE;
+    option.variant.int_val = value;
+    return cgdbrc_set_val(option);
+}
+
+static int command_set_scrollbackbuffersize(int value)
+{
+    struct cgdbrc_config_option option;
+
+    /* The scroller always keeps the line being written to */
+    if (value < 1)
+        return 1;
+
+    option.option_kind = CGDBRC_SCROLLBACK_BUFFER_SIZE;
+    option.variant.int_val = value;
+    return cgdbrc_set_val(option);
+}
+
+static int command_set_outputlimit(int value)
+{
+    struct cgdbrc_config_option option;
+
+    /* Lines of program output shown per second, 0 means there is no limit */
+    if (value < 0)
+        return 1;
+
+    option.option_kind = CGDBRC_OUTPUTLIMIT;
+    option.variant.int_val = value;
+    return cgdbrc_set_val(option);
+}
+
+static int command_set_pipelinedepth(int value)
+{
+    struct cgdbrc_config_option option;
+
+    /* At least 1 command has to be sent to GDB */
+    if (value < 1)
+        return 1;
+
+    option.option_kind = CGDBRC_PIPELINEDEPTH;
+    option.variant.int_val = value;
+
+    if (cgdbrc_set_val(option))
+        return 1;
+
+    tgdb_set_pipeline_depth(tgdb, value);
+
+    return 0;
+}
+
 static int command_set_timeout(int value)
 {
     struct cgdbrc_config_option option;
@@ -555,7 +653,14 @@ int command_parse_syntax(int param)
 
 static int command_parse_highlight(int param)
 {
-    return hl_groups_parse_config(hl_groups_instance);
+    struct sviewer *sview = if_get_sview();
+    int result = hl_groups_parse_config(hl_groups_instance);
+
+    /* The source window can not tell that the colors changed */
+    if (sview)
+        source_damage(sview);
+
+    return result;
 }
 
 extern struct kui_map_set *kui_map, *kui_imap;
@@ -104,8 +104,13 @@ enum cgdbrc_option_kind {
     CGDBRC_ARROWSTYLE,
     CGDBRC_AUTOSOURCERELOAD,
     CGDBRC_CGDB_MODE_KEY,
+    CGDBRC_FRAMERATE,
     CGDBRC_IGNORECASE,
+    CGDBRC_OUTPUTLIMIT,
+    CGDBRC_PIPELINEDEPTH,
+    CGDBRC_SCROLLBACK_BUFFER_SIZE,
     CGDBRC_SHOWTGDBCOMMANDS,
+    CGDBRC_SOURCECACHESIZE,
     CGDBRC_SYNTAX,
     CGDBRC_TABSTOP,
     CGDBRC_TIMEOUT,
@@ -125,8 +130,13 @@ struct cgdbrc_config_option {
         enum ArrowStyle arrow_style;
         /* option_kind == CGDBRC_AUTOSOURCERELOAD */
         /* option_kind == CGDBRC_CGDB_MODE_KEY */
+        /* option_kind == CGDBRC_FRAMERATE */
         /* option_kind == CGDBRC_IGNORECASE */
+        /* option_kind == CGDBRC_OUTPUTLIMIT */
+        /* option_kind == CGDBRC_PIPELINEDEPTH */
+        /* option_kind == CGDBRC_SCROLLBACK_BUFFER_SIZE */
         /* option_kind == CGDBRC_SHOWTGDBCOMMANDS */
+        /* option_kind == CGDBRC_SOURCECACHESIZE */
         /* option_kind == CGDBRC_TABSTOP */
         /* option_kind == CGDBRC_TIMEOUT */
         /* option_kind == CGDBRC_TIMEOUTLEN */
@@ -29,7 +29,6 @@
 struct file_buffer {
     int length;                 /* Number of files in program */
     char **files;               /* Array containing file */
-    char *cur_line;             /* cur line may have unique color */
     int max_width;              /* Width of longest line in file */
 
     int sel_line;               /* Current line selected in file dialog */
@@ -38,6 +37,9 @@ struct file_buffer {
     int sel_col_rbeg;           /* Current beg column matched in regex */
     int sel_col_rend;           /* Current end column matched in regex */
     int sel_rline;              /* Current line used by regex */
+    int sel_col_sbeg;           /* Beg column of the match shown while
+                                 * searching on sel_line, or -1 */
+    int sel_col_send;           /* End column of that match, or -1 */
 };
 
 struct filedlg {
@@ -96,13 +98,14 @@ struct filedlg *filedlg_new(int pos_r, int pos_c, int height, int width)
 
     fd->buf->length = 0;
     fd->buf->files = NULL;
-    fd->buf->cur_line = NULL;
     fd->buf->max_width = 0;
     fd->buf->sel_line = 0;
     fd->buf->sel_col = 0;
     fd->buf->sel_col_rbeg = 0;
     fd->buf->sel_col_rend = 0;
     fd->buf->sel_rline = 0;
+    fd->buf->sel_col_sbeg = -1;
+    fd->buf->sel_col_send = -1;
 
     return fd;
 }
@@ -184,9 +187,6 @@ void filedlg_clear(struct filedlg *fd)
     free(fd->buf->files);
     fd->buf->files = NULL;
 
-    free(fd->buf->cur_line);
-    fd->buf->cur_line = NULL;
-
     fd->buf->max_width = 0;
     fd->buf->length = 0;
     fd->buf->sel_line = 0;
@@ -194,6 +194,8 @@ void filedlg_clear(struct filedlg *fd)
     fd->buf->sel_col_rbeg = 0;
     fd->buf->sel_col_rend = 0;
     fd->buf->sel_rline = 0;
+    fd->buf->sel_col_sbeg = -1;
+    fd->buf->sel_col_send = -1;
 }
 
 static void filedlg_vscroll(struct filedlg *fd, int offset)
@@ -247,10 +249,10 @@ static int filedlg_search_regex(struct filedlg *fd, const char *regex,
         return -1;
 
     return hl_regex(regex,
-            (const char **) fd->buf->files,
             (const char **) fd->buf->files,
             fd->buf->length,
-            &fd->buf->cur_line, &fd->buf->sel_line,
+            &fd->buf->sel_col_sbeg, &fd->buf->sel_col_send,
+            &fd->buf->sel_line,
             &fd->buf->sel_rline, &fd->buf->sel_col_rbeg,
             &fd->buf->sel_col_rend, opt, direction, icase);
 }
@@ -326,12 +328,9 @@ int filedlg_display(struct filedlg *fd)
                 waddch(fd->win, '-');
                 waddch(fd->win, '>');
                 wattroff(fd->win, attr);
-                if (fd->buf->cur_line != NULL)
-                    hl_wprintw(fd->win, fd->buf->cur_line, width - lwidth - 2,
-                            fd->buf->sel_col);
-                else
-                    hl_wprintw(fd->win, fd->buf->files[file],
-                            width - lwidth - 2, fd->buf->sel_col);
+                hl_wprintw(fd->win, fd->buf->files[file], NULL,
+                        width - lwidth - 2, fd->buf->sel_col,
+                        fd->buf->sel_col_sbeg, fd->buf->sel_col_send);
             }
             /* Ordinary file */
             else {
@@ -342,12 +341,8 @@ int filedlg_display(struct filedlg *fd)
                 waddch(fd->win, ' ');
 
                 /* No special file information */
-                if (file == fd->buf->sel_line && fd->buf->cur_line != NULL)
-                    hl_wprintw(fd->win, fd->buf->cur_line, width - lwidth - 2,
-                            fd->buf->sel_col);
-                else
-                    hl_wprintw(fd->win, fd->buf->files[file],
-                            width - lwidth - 2, fd->buf->sel_col);
+                hl_wprintw(fd->win, fd->buf->files[file], NULL,
+                        width - lwidth - 2, fd->buf->sel_col, -1, -1);
             }
         } else {
             wprintw(fd->win, "%s\n", fd->buf->files[file]);
@@ -402,72 +397,67 @@ void filedlg_display_message(struct filedlg *fd, char *message)
     wrefresh(fd->win);
 }
 
-/* capture_regex: Captures a regular expression from the user.
- * ---------------
+/* capture_regex: Captures a regular expression from the user, one key at
+ * --------------- a time. Called for each key while regex_search is set.
+ *
+ *  key: The key the user typed
+ *
  *  Side Effect: 
  *
  *  regex_line: The regex the user has entered.
  *  regex_line_pos: The next available index into regex_line.
+ *  regex_search: Cleared when the user finishes or cancels the regex.
  *
- * Return Value: 0 if user gave a regex, otherwise 1.
+ * Return Value: 0 if user gave a regex, 1 if the user cancelled it,
+ *               or 2 if the regex is not finished yet.
  */
-static int capture_regex(struct filedlg *fd)
+static int capture_regex(struct filedlg *fd, int key)
 {
-    int c;
-    extern struct kui_manager *kui_ctx;
-
-    /* Initialize the function for finding a regex and tell user */
-    regex_search = 1;
-    regex_line_pos = 0;
-    regex_line[regex_line_pos] = '\0';
-    filedlg_display(fd);
-
-    do {
-        c = kui_manager_getkey_blocking(kui_ctx);
+    if (regex_line_pos == (MAX_LINE - 1) && !(key == CGDB_KEY_ESC || key == 8
+                    || key == 127))
+        return 2;
 
-        if (regex_line_pos == (MAX_LINE - 1) && !(c == CGDB_KEY_ESC || c == 8
-                        || c == 127))
-            continue;
-
-        /* Quit the search if the user hit escape */
-        if (c == CGDB_KEY_ESC) {
-            regex_line_pos = 0;
-            regex_line[regex_line_pos] = '\0';
-            regex_search = 0;
-            filedlg_search_regex(fd, regex_line, 2, regex_direction, 1);
-            filedlg_display(fd);
-            return 1;
-        }
-
-        /* If the user hit enter, then a successful regex has been recieved */
-        if (c == '\r' || c == '\n' || c == CGDB_KEY_CTRL_M) {
-            regex_line[regex_line_pos] = '\0';
-            break;
-        }
+    /* Quit the search if the user hit escape */
+    if (key == CGDB_KEY_ESC) {
+        regex_line_pos = 0;
+        regex_line[regex_line_pos] = '\0';
+        regex_search = 0;
+        filedlg_search_regex(fd, regex_line, 2, regex_direction, 1);
+        filedlg_display(fd);
+        return 1;
+    }
 
-        /* If the user hit backspace or delete remove a char */
-        if (CGDB_BACKSPACE_KEY(c)) {
-            if (regex_line_pos > 0)
-                --regex_line_pos;
+    /* If the user hit enter, then a successful regex has been recieved */
+    if (key == '\r' || key == '\n' || key == CGDB_KEY_CTRL_M) {
+        regex_line[regex_line_pos] = '\0';
+        regex_search = 0;
+        filedlg_search_regex(fd, regex_line, 2, regex_direction, 1);
+        filedlg_display(fd);
+        return 0;
+    }
 
-            regex_line[regex_line_pos] = '\0';
-            filedlg_search_regex(fd, regex_line, 1, regex_direction, 1);
-            filedlg_display(fd);
-            continue;
-        }
+    /* If the user hit backspace or delete remove a char */
+    if (CGDB_BACKSPACE_KEY(key)) {
+        if (regex_line_pos > 0)
+            --regex_line_pos;
 
-        /* Add a char, search and draw */
-        regex_line[regex_line_pos++] = c;
         regex_line[regex_line_pos] = '\0';
         filedlg_search_regex(fd, regex_line, 1, regex_direction, 1);
         filedlg_display(fd);
-    } while (1);
+        return 2;
+    }
 
-    /* Finished */
-    regex_search = 0;
-    filedlg_search_regex(fd, regex_line, 2, regex_direction, 1);
+    /* Add a char, search and draw */
+    regex_line[regex_line_pos++] = key;
+    regex_line[regex_line_pos] = '\0';
+    filedlg_search_regex(fd, regex_line, 1, regex_direction, 1);
     filedlg_display(fd);
-    return 0;
+    return 2;
+}
+
+int filedlg_is_searching(struct filedlg *fd)
+{
+    return regex_search;
 }
 
 int filedlg_recv_char(struct filedlg *fd, int key, char *file)
@@ -477,6 +467,12 @@ int filedlg_recv_char(struct filedlg *fd, int key, char *file)
     /* Initialize size variables */
     getmaxyx(fd->win, height, width);
 
+    /* The keys typed after / or ? make up the regex */
+    if (regex_search) {
+        capture_regex(fd, key);
+        return 0;
+    }
+
     filedlg_display(fd);
 
     switch (key) {
@@ -512,9 +508,11 @@ int filedlg_recv_char(struct filedlg *fd, int key, char *file)
         case '?':
             regex_direction = ('/' == key);
 
-            /* Capturing regular expressions */
+            /* Start capturing a regular expression */
             filedlg_search_regex_init(fd);
-            capture_regex(fd);
+            regex_search = 1;
+            regex_line_pos = 0;
+            regex_line[regex_line_pos] = '\0';
             break;
         case 'n':
             filedlg_search_regex(fd, regex_line, 2, regex_direction, 1);
@@ -48,6 +48,16 @@ void filedlg_clear(struct filedlg *fd);
  */
 int filedlg_recv_char(struct filedlg *fd, int key, char *file);
 
+/* filedlg_is_searching: Checks if the filedlg is reading a regex from the
+ * ---------------------  user. Every key should go to filedlg_recv_char
+ *                        until it is finished, including ESC.
+ *
+ *   fdlg:  The file dialog to check.
+ *
+ * Return Value: 1 if a regex is being read, otherwise 0.
+ */
+int filedlg_is_searching(struct filedlg *fd);
+
 /* filedlg_display_message: Displays a message on the filedlg window status bar.
  * ------------------------
  *
@@ -14,10 +14,6 @@
 #include <ctype.h>
 #endif /* HAVE_CTYPE_H */
 
-#if HAVE_LIMITS_H
-#include <limits.h>             /* CHAR_MAX */
-#endif /* HAVE_LIMITS_H */
-
 #if HAVE_STRING_H
 #include <string.h>
 #endif /* HAVE_STRING_H */
@@ -34,6 +30,22 @@
 #include <regex.h>
 #endif /* HAVE_REGEX_H */
 
+#if HAVE_ERRNO_H
+#include <errno.h>
+#endif /* HAVE_ERRNO_H */
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+
+#if HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+
+#if HAVE_PTHREAD_H
+#include <pthread.h>
+#endif /* HAVE_PTHREAD_H */
+
 /* Local Includes */
 #include "highlight.h"
 #include "highlight_groups.h"
@@ -48,104 +60,405 @@
 /* Definitions */
 /* ----------- */
 
-#define HL_CHAR CHAR_MAX        /* Special marker character */
+/* Number of lines highlighted beyond each end of a requested range */
+#define HL_LOOKAHEAD 64
+
+/* A range of lines to highlight.
+ *
+ * A job is created by the main thread from the state of a node. It is then
+ * run, possibly by the highlighting thread, without looking at the node at
+ * all. The results are copied into the node by the main thread. */
+struct hl_job {
+    /* The node the lines are for, only dereferenced by the main thread */
+    struct list_node *node;
+
+    /* The text of the file to tokenize, and its language. The text belongs
+     * to the node, highlight_forget waits for a running job to let go of it
+     * before the node's buffer is released. */
+    const char *text;
+    size_t size;
+    enum tokenizer_language_support language;
+
+    /* The line tokenizing starts at, its text offset and lexer state */
+    int first;
+    long offset;
+    int state;
+
+    /* The lines to highlight, [start, end) */
+    int start;
+    int end;
+
+    /* The highlighted lines, lines[i] is line start + i.
+     * Lines that were not reached are left unhighlighted. */
+    struct hl_line *lines;
+
+    /* The lexer states found after the node's last known checkpoint.
+     * states[i] is checkpoint number states_first + i. */
+    int states_first;
+    int *states;
+    int states_length;
+
+    /* Set when the node has gone away while the job was running */
+    int cancelled;
+
+    /* Set when the file could not be tokenized */
+    int error;
+
+    struct hl_job *next;
+};
+
+#if HAVE_PTHREAD_H
+/* The highlighting thread.
+ *
+ * The main thread hands it at most one pending job at a time, a newer
+ * request replaces an older one that has not started. Finished jobs are
+ * queued on done, and a byte is written to the pipe so that the main
+ * loop wakes up and collects them with highlight_worker_collect. */
+static struct {
+    pthread_t thread;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_cond_t idle;
+    int pipe[2];
+    /* Set while the thread takes jobs, it clears it when it stops early.
+     * While the thread runs, it is only used with the mutex held. */
+    int running;
+    /* Set from creating the thread until it is joined. Only the main
+     * thread changes it, while no thread is running, so it is read
+     * without the mutex. */
+    int started;
+    int quit;
+
+    struct hl_job *pending;
+    struct hl_job *current;
+    struct hl_job *done;
+} worker;
+#endif /* HAVE_PTHREAD_H */
 
 /* --------------- */
-/* Local Variables */
+/* Local Functions */
 /* --------------- */
 
-static int highlight_node(struct list_node *node)
+/* hl_token_group: Returns the highlighting group of a kind of token.
+ * ---------------
+ *
+ *   e:  The kind of token
+ */
+static enum hl_group_kind hl_token_group(enum tokenizer_type e)
 {
-    struct tokenizer *t = tokenizer_init();
-    int ret;
-    struct ibuf *ibuf = ibuf_init();
+    switch (e) {
+        case TOKENIZER_KEYWORD:
+            return HLG_KEYWORD;
+        case TOKENIZER_TYPE:
+            return HLG_TYPE;
+        case TOKENIZER_LITERAL:
+            return HLG_LITERAL;
+        case TOKENIZER_COMMENT:
+            return HLG_COMMENT;
+        case TOKENIZER_DIRECTIVE:
+            return HLG_DIRECTIVE;
+        case TOKENIZER_NUMBER:
+        case TOKENIZER_TEXT:
+        case TOKENIZER_ERROR:
+        default:
+            return HLG_TEXT;
+    }
+}
 
-    ibuf_addchar(ibuf, HL_CHAR);
-    ibuf_addchar(ibuf, HLG_TEXT);
+/* hl_line_set: Stores the spans of a line.
+ * ------------
+ *
+ *   hl:      The highlighting of the line
+ *   spans:   The spans found in the line
+ *   length:  The number of spans
+ */
+static void hl_line_set(struct hl_line *hl, const struct hl_span *spans,
+        int length)
+{
+    hl->length = length;
+    hl->spans = NULL;
 
-    /* Initialize */
-    node->buf.length = 0;
-    node->buf.tlines = NULL;
-    node->buf.max_width = 0;
+    if (length > 0) {
+        hl->spans = cgdb_malloc(sizeof (struct hl_span) * length);
+        memcpy(hl->spans, spans, sizeof (struct hl_span) * length);
+    }
+}
 
-    if (tokenizer_set_file(t, node->path, node->language) == -1) {
-        if_print_message("%s:%d tokenizer_set_file error", __FILE__, __LINE__);
-        return -1;
+static void hl_job_free(struct hl_job *job)
+{
+    int i;
+
+    for (i = 0; i < job->end - job->start; i++)
+        free(job->lines[i].spans);
+
+    free(job->lines);
+    free(job->states);
+    free(job);
+}
+
+/* hl_job_create: Creates a job for the lines of a range not highlighted yet.
+ * --------------
+ *
+ *   node:   The node to highlight
+ *   start:  The first line to highlight
+ *   end:    The line after the last line to highlight
+ *
+ * Return Value:  The new job, or NULL if there is nothing to highlight.
+ */
+static struct hl_job *hl_job_create(struct list_node *node, int start,
+        int end)
+{
+    struct hl_job *job;
+    int checkpoint, i;
+
+    if (!node->hl_lines)
+        return NULL;
+
+    start -= HL_LOOKAHEAD;
+    if (start < 0)
+        start = 0;
+
+    end += HL_LOOKAHEAD;
+    if (end > node->buf.length)
+        end = node->buf.length;
+
+    /* Only the lines not yet highlighted need to be tokenized */
+    while (start < end && node->hl_lines[start].length != -1)
+        start++;
+
+    while (end > start && node->hl_lines[end - 1].length != -1)
+        end--;
+
+    if (start == end)
+        return NULL;
+
+    /* Resume tokenizing at the closest known lexer state before start */
+    checkpoint = start / HL_CHECKPOINT_INTERVAL;
+    if (checkpoint >= node->hl_checkpoints_length)
+        checkpoint = node->hl_checkpoints_length - 1;
+
+    job = cgdb_calloc(1, sizeof (struct hl_job));
+    job->node = node;
+    job->text = node->buf.file_data;
+    job->size = node->buf.file_size;
+    job->language = node->language;
+    job->first = checkpoint * HL_CHECKPOINT_INTERVAL;
+    job->offset = node->buf.tlines[job->first] - node->buf.file_data;
+    job->state = node->hl_checkpoints[checkpoint];
+    job->start = start;
+    job->end = end;
+    job->lines = cgdb_malloc(sizeof (struct hl_line) * (end - start));
+    for (i = 0; i < end - start; i++) {
+        job->lines[i].spans = NULL;
+        job->lines[i].length = -1;
+    }
+    job->states_first = node->hl_checkpoints_length;
+    job->states = cgdb_malloc(sizeof (int) *
+            (end / HL_CHECKPOINT_INTERVAL + 1));
+
+    return job;
+}
+
+#if HAVE_PTHREAD_H
+static int hl_job_cancelled(struct hl_job *job)
+{
+    int cancelled = 0;
+
+    if (worker.started) {
+        pthread_mutex_lock(&worker.mutex);
+        cancelled = job->cancelled || worker.quit;
+        pthread_mutex_unlock(&worker.mutex);
+    }
+
+    return cancelled;
+}
+#else
+#define hl_job_cancelled(job) 0
+#endif /* HAVE_PTHREAD_H */
+
+/* hl_job_run: Tokenizes the lines of a job.
+ * -----------
+ *
+ * This only uses the job itself, so that it is safe to call from the
+ * highlighting thread.
+ *
+ *   job:  The job to run
+ */
+static void hl_job_run(struct hl_job *job)
+{
+    struct tokenizer *t;
+    struct hl_span *spans = NULL;
+    int spans_length = 0, spans_capacity = 0;
+    int line = job->first, column = 0;
+
+    t = tokenizer_init();
+    if (tokenizer_set_buffer(t, job->text, job->size, job->language) == -1 ||
+            tokenizer_seek(t, job->offset, job->state) == -1) {
+        job->error = 1;
+        tokenizer_destroy(t);
+        return;
     }
 
-    while ((ret = tokenizer_get_token(t)) > 0) {
+    while (line < job->end && tokenizer_get_token(t) > 0) {
         enum tokenizer_type e = tokenizer_get_packet_type(t);
+        const char *data = tokenizer_get_data(t);
+        enum hl_group_kind group;
+
+        /* The line index only breaks lines at a '\n', a lone '\r' is
+         * part of the line */
+        if (e != TOKENIZER_NEWLINE || strcmp(data, "\r") == 0) {
+            group = hl_token_group(e);
+
+            /* Lines before start are only tokenized to get the lexer state */
+            if (line >= job->start && group != HLG_TEXT) {
+                /* Tokens of the same group are joined into one span */
+                if (spans_length > 0 &&
+                        spans[spans_length - 1].group == group &&
+                        spans[spans_length - 1].start +
+                        spans[spans_length - 1].length == column) {
+                    spans[spans_length - 1].length += strlen(data);
+                } else {
+                    if (spans_length == spans_capacity) {
+                        spans_capacity = spans_capacity ?
+                                spans_capacity * 2 : 16;
+                        spans = cgdb_realloc(spans,
+                                sizeof (struct hl_span) * spans_capacity);
+                    }
 
-        /*if_print_message  ( "TOKEN(%d:%s)\n", e, tokenizer_get_printable_enum ( e ) ); */
+                    spans[spans_length].start = column;
+                    spans[spans_length].length = strlen(data);
+                    spans[spans_length].group = group;
+                    spans_length++;
+                }
+            }
 
-        switch (e) {
-            case TOKENIZER_KEYWORD:
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_KEYWORD);
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_TYPE:
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TYPE);
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_LITERAL:
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_LITERAL);
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_NUMBER:
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                break;
-            case TOKENIZER_COMMENT:
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_COMMENT);
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_DIRECTIVE:
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_DIRECTIVE);
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_TEXT:
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                break;
-            case TOKENIZER_NEWLINE:
-                node->buf.length++;
-                node->buf.tlines =
-                        realloc(node->buf.tlines,
-                        sizeof (char *) * node->buf.length);
-                node->buf.tlines[node->buf.length - 1] = strdup(ibuf_get(ibuf));
-
-                if (ibuf_length(ibuf) > node->buf.max_width)
-                    node->buf.max_width = ibuf_length(ibuf);
-
-                ibuf_clear(ibuf);
-                ibuf_addchar(ibuf, HL_CHAR);
-                ibuf_addchar(ibuf, HLG_TEXT);
-                break;
-            case TOKENIZER_ERROR:
-                ibuf_add(ibuf, tokenizer_get_data(t));
-                break;
-            default:
-                return -1;
+            column += strlen(data);
+            continue;
+        }
+
+        if (line >= job->start)
+            hl_line_set(&job->lines[line - job->start], spans, spans_length);
+
+        line++;
+        column = 0;
+        spans_length = 0;
+
+        /* Remember the lexer state, so this line never has to be
+         * tokenized from an earlier line again */
+        if (line % HL_CHECKPOINT_INTERVAL == 0) {
+            if (line / HL_CHECKPOINT_INTERVAL ==
+                    job->states_first + job->states_length)
+                job->states[job->states_length++] = tokenizer_get_state(t);
+
+            if (hl_job_cancelled(job))
                 break;
         }
     }
 
-    return 0;
+    /* The last line of the file may not end in a newline */
+    if (line >= job->start && line < job->end)
+        hl_line_set(&job->lines[line - job->start], spans, spans_length);
+
+    free(spans);
+    tokenizer_destroy(t);
+}
+
+/* hl_job_install: Moves the results of a job into its node.
+ * ---------------
+ *
+ *   job:  A job that has been run
+ *
+ * Return Value:  The number of lines that were highlighted.
+ */
+static int hl_job_install(struct hl_job *job)
+{
+    struct list_node *node = job->node;
+    int i, count = 0;
+
+    if (job->error) {
+        if_print_message("%s:%d tokenizer_set_buffer error", __FILE__,
+                __LINE__);
+        return 0;
+    }
+
+    for (i = 0; i < job->end - job->start; i++) {
+        if (job->lines[i].length != -1 &&
+                node->hl_lines[job->start + i].length == -1) {
+            node->hl_lines[job->start + i] = job->lines[i];
+            job->lines[i].spans = NULL;
+            count++;
+        }
+    }
+
+    /* Another job may have found some of the states already */
+    for (i = 0; i < job->states_length; i++) {
+        if (job->states_first + i == node->hl_checkpoints_length)
+            node->hl_checkpoints[node->hl_checkpoints_length++] =
+                    job->states[i];
+    }
+
+    return count;
+}
+
+#if HAVE_PTHREAD_H
+static void *hl_worker_main(void *arg)
+{
+    struct hl_job *job, **last;
+    char c = 0;
+
+    pthread_mutex_lock(&worker.mutex);
+
+    for (;;) {
+        while (!worker.pending && !worker.quit)
+            pthread_cond_wait(&worker.cond, &worker.mutex);
+
+        if (worker.quit)
+            break;
+
+        job = worker.current = worker.pending;
+        worker.pending = NULL;
+        pthread_mutex_unlock(&worker.mutex);
+
+        hl_job_run(job);
+
+        pthread_mutex_lock(&worker.mutex);
+        worker.current = NULL;
+        pthread_cond_broadcast(&worker.idle);
+
+        if (job->cancelled) {
+            hl_job_free(job);
+            continue;
+        }
+
+        /* Queue the job in order and wake up the main loop */
+        for (last = &worker.done; *last; last = &(*last)->next);
+        *last = job;
+
+        /* Without a way to wake up the main loop, it highlights the
+         * lines itself from now on */
+        if (write(worker.pipe[1], &c, 1) == -1 && errno != EAGAIN) {
+            worker.running = 0;
+            break;
+        }
+    }
+
+    pthread_mutex_unlock(&worker.mutex);
+
+    return NULL;
 }
 
+/* hl_worker_covers: Checks if a job already covers a range of a node.
+ * -----------------
+ *
+ * The worker mutex must be held.
+ */
+static int hl_worker_covers(struct hl_job *job, struct hl_job *range)
+{
+    return job && !job->cancelled && job->node == range->node &&
+            job->start <= range->start && job->end >= range->end;
+}
+#endif /* HAVE_PTHREAD_H */
+
 /* --------- */
 /* Functions */
 /* --------- */
@@ -154,200 +467,342 @@ static int highlight_node(struct list_node *node)
 
 void highlight(struct list_node *node)
 {
-    if (node->language == TOKENIZER_LANGUAGE_UNKNOWN) {
-        /* Just copy the lines from the original buffer if no highlighting 
-         * is possible */
-        int i;
-
-        node->buf.length = node->orig_buf.length;
-        node->buf.max_width = node->orig_buf.max_width;
-        node->buf.tlines = cgdb_malloc(sizeof (char *) * node->orig_buf.length);
-        for (i = 0; i < node->orig_buf.length; i++)
-            node->buf.tlines[i] = cgdb_strdup(node->orig_buf.tlines[i]);
-    } else
-        highlight_node(node);
+    int i;
+
+    /* Results computed for the previous language are useless */
+    highlight_forget(node);
+
+    /* Discard the lines highlighted for the previous language */
+    highlight_free(node);
+
+    /* Without highlighting, the lines are drawn as plain text */
+    if (node->language == TOKENIZER_LANGUAGE_UNKNOWN || node->buf.length == 0)
+        return;
+
+    /* Lines are highlighted on demand, by highlight_lines */
+    node->hl_lines = cgdb_malloc(sizeof (struct hl_line) * node->buf.length);
+    for (i = 0; i < node->buf.length; i++) {
+        node->hl_lines[i].spans = NULL;
+        node->hl_lines[i].length = -1;
+    }
+
+    node->hl_checkpoints = cgdb_malloc(sizeof (int) *
+            (node->buf.length / HL_CHECKPOINT_INTERVAL + 1));
+    node->hl_checkpoints[0] = TOKENIZER_INITIAL_STATE;
+    node->hl_checkpoints_length = 1;
 }
 
-/* highlight_line_segment: Creates a new line that is hightlighted.
- * ------------------------
- *
- *  orig:   The line that needs to be highlighted.
- *  start:  The desired starting position of the highlighted portion.
- *          The start index *is* included in the highlighted segment.
- *  end:    The desired ending position of the highlighted portion.
- *          The end index *is not* include in the highlighted segment.
- *
- *  Return Value: Null on error. Or a pointer to a new line that
- *  has highlighting. The new line MUST BE FREED.
- */
-/*#define HIGHLIGHT_DEBUG*/
-static char *highlight_line_segment(const char *orig, int start, int end)
+void highlight_free(struct list_node *node)
 {
-    char *new_line = NULL;
-    int length = strlen(orig), j = 0, pos = 0;
-    int syn_search_recieved = 0, cur_color = HLG_TEXT;
+    int i;
 
-    /* Cases not possible */
-    if (start > end || orig == NULL ||
-            start > length || start < 0 || end > length || end < 0)
-        return NULL;
+    if (node->hl_lines) {
+        for (i = 0; i < node->buf.length; i++)
+            free(node->hl_lines[i].spans);
+        free(node->hl_lines);
+    }
 
-    /* The 5 is: color start (2), color end (2) and EOL */
-    if ((new_line = (char *) malloc(sizeof (char) * (length + 5))) == NULL)
-        return NULL;
+    free(node->hl_checkpoints);
 
-#ifdef HIGHLIGHT_DEBUG
-    /*
-       for ( j = 0; j < strlen(orig); j++ ) {
-       char temp[100];
-       sprintf(temp, "(%d:%c)", orig[j], orig[j]);
-       scr_add(gdb_win, temp);
-       }
-       scr_add(gdb_win, "\r\n");
-       scr_refresh(gdb_win, 1);
-     */
-#endif
-
-    /* This traverses the input line. It creates a new line with the section
-     *     given highlighted.
-     * If a highlight symbol is encountered, the end and/or start position 
-     *     is incremented because the original match was against only the text,
-     *     not against the color embedded text :)
-     */
-    for (j = 0; j < length; j++) {
-        if (orig[j] == HL_CHAR) {
-            if (j <= start)
-                start += 2;
-
-            if (j <= end)
-                end += 2;
-
-            cur_color = orig[j + 1];
-        }
+    node->hl_lines = NULL;
+    node->hl_checkpoints = NULL;
+    node->hl_checkpoints_length = 0;
+}
 
-        /* Mark when the search is started and when it ends */
-        if (j == start) {
-            syn_search_recieved = 1;
-            new_line[pos++] = HL_CHAR;
-            new_line[pos++] = HLG_SEARCH;
-        } else if (j == end) {
-            syn_search_recieved = 0;
-            new_line[pos++] = HL_CHAR;
-            new_line[pos++] = cur_color;
+int highlight_lines(struct list_node *node, int start, int end)
+{
+    struct hl_job *job;
+    int count;
+
+    job = hl_job_create(node, start, end);
+    if (!job)
+        return 0;
+
+#if HAVE_PTHREAD_H
+    if (worker.started) {
+        pthread_mutex_lock(&worker.mutex);
+
+        /* The thread may have stopped early */
+        if (worker.running) {
+            if (hl_worker_covers(worker.current, job) ||
+                    hl_worker_covers(worker.pending, job)) {
+                hl_job_free(job);
+            } else {
+                if (worker.pending)
+                    hl_job_free(worker.pending);
+                worker.pending = job;
+                pthread_cond_signal(&worker.cond);
+            }
+
+            pthread_mutex_unlock(&worker.mutex);
+            return 0;
         }
 
-        new_line[pos++] = orig[j];
+        pthread_mutex_unlock(&worker.mutex);
+    }
+#endif /* HAVE_PTHREAD_H */
 
-        /* If the search has started, then make all the colors the 
-         * highlighted colors  */
-        if (syn_search_recieved && orig[j] == HL_CHAR) {
-            ++j;
-            new_line[pos++] = HLG_SEARCH;
-        }
+    hl_job_run(job);
+    count = hl_job_install(job);
+    hl_job_free(job);
+
+    return count;
+}
+
+void highlight_forget(struct list_node *node)
+{
+#if HAVE_PTHREAD_H
+    struct hl_job *job, **prev;
+
+    if (!worker.started)
+        return;
+
+    pthread_mutex_lock(&worker.mutex);
+
+    if (worker.pending && worker.pending->node == node) {
+        hl_job_free(worker.pending);
+        worker.pending = NULL;
+    }
+
+    /* The thread frees the job, wait until it stops reading the text */
+    if (worker.current && worker.current->node == node) {
+        worker.current->cancelled = 1;
+
+        while (worker.current && worker.current->node == node)
+            pthread_cond_wait(&worker.idle, &worker.mutex);
+    }
+
+    for (prev = &worker.done; (job = *prev);) {
+        if (job->node == node) {
+            *prev = job->next;
+            hl_job_free(job);
+        } else
+            prev = &job->next;
+    }
+
+    pthread_mutex_unlock(&worker.mutex);
+#endif /* HAVE_PTHREAD_H */
+}
+
+int highlight_worker_start(void)
+{
+#if HAVE_PTHREAD_H
+    if (worker.started)
+        return worker.pipe[0];
+
+    if (pipe(worker.pipe) == -1)
+        return -1;
+
+    /* Neither end may block, the thread must not wait for the main loop */
+    fcntl(worker.pipe[0], F_SETFL, O_NONBLOCK);
+    fcntl(worker.pipe[1], F_SETFL, O_NONBLOCK);
+
+    pthread_mutex_init(&worker.mutex, NULL);
+    pthread_cond_init(&worker.cond, NULL);
+    pthread_cond_init(&worker.idle, NULL);
+    worker.quit = 0;
+    worker.running = 1;
+    worker.started = 1;
+
+    if (pthread_create(&worker.thread, NULL, hl_worker_main, NULL) != 0) {
+        worker.running = 0;
+        worker.started = 0;
+        close(worker.pipe[0]);
+        close(worker.pipe[1]);
+        return -1;
     }
 
-    new_line[pos] = '\0';
+    return worker.pipe[0];
+#else
+    return -1;
+#endif /* HAVE_PTHREAD_H */
+}
+
+int highlight_worker_collect(void)
+{
+#if HAVE_PTHREAD_H
+    struct hl_job *job, *done;
+    char c[64];
+    int count = 0;
+
+    if (!worker.started)
+        return 0;
+
+    /* Drain the wake ups, the queue says what is ready */
+    while (read(worker.pipe[0], c, sizeof (c)) > 0);
+
+    pthread_mutex_lock(&worker.mutex);
+    done = worker.done;
+    worker.done = NULL;
+    pthread_mutex_unlock(&worker.mutex);
+
+    while ((job = done)) {
+        done = job->next;
+        count += hl_job_install(job);
+        hl_job_free(job);
+    }
 
-#ifdef HIGHLIGHT_DEBUG
-    for (j = 0; j < strlen(new_line); j++) {
-        char temp[100];
+    return count;
+#else
+    return 0;
+#endif /* HAVE_PTHREAD_H */
+}
+
+void highlight_worker_stop(void)
+{
+#if HAVE_PTHREAD_H
+    struct hl_job *job;
+
+    if (!worker.started)
+        return;
 
-        fprintf(stderr, "(%d:%c)\r\n", new_line[j], new_line[j]);
+    pthread_mutex_lock(&worker.mutex);
+    worker.quit = 1;
+    pthread_cond_signal(&worker.cond);
+    pthread_mutex_unlock(&worker.mutex);
+
+    pthread_join(worker.thread, NULL);
+    worker.running = 0;
+    worker.started = 0;
+
+    pthread_cond_destroy(&worker.idle);
+    pthread_cond_destroy(&worker.cond);
+    pthread_mutex_destroy(&worker.mutex);
+
+    if (worker.pending)
+        hl_job_free(worker.pending);
+    worker.pending = NULL;
+
+    while ((job = worker.done)) {
+        worker.done = job->next;
+        hl_job_free(job);
     }
-#endif
 
-    /* Now the line has new information in it.
-     * Lets traverse it again and correct the highlighting to be the 
-     * reverse.
-     */
+    close(worker.pipe[0]);
+    close(worker.pipe[1]);
+#endif /* HAVE_PTHREAD_H */
+}
+
+/* hl_next_run: Finds the run of characters drawn in the same group.
+ * ------------
+ *
+ *   hl:           The highlighting of the line, or NULL
+ *   span:         The index of the first span that may contain pos, it is
+ *                 advanced past the spans that end before pos
+ *   pos:          The position of the first character of the run
+ *   length:       The length of the line
+ *   match_start:  The start of the search match in the line, or -1
+ *   match_end:    The end of the search match in the line, or -1
+ *   group:        Returns the group of the run
+ *
+ * Return Value:  The position after the last character of the run.
+ */
+static int hl_next_run(const struct hl_line *hl, int *span, int pos,
+        int length, int match_start, int match_end, enum hl_group_kind *group)
+{
+    int end = length;
+
+    *group = HLG_TEXT;
 
-    return new_line;
+    if (hl) {
+        while (*span < hl->length &&
+                hl->spans[*span].start + hl->spans[*span].length <= pos)
+            (*span)++;
+
+        if (*span < hl->length) {
+            const struct hl_span *cur = &hl->spans[*span];
+
+            if (cur->start <= pos) {
+                *group = cur->group;
+                end = cur->start + cur->length;
+            } else
+                end = cur->start;
+        }
+    }
+
+    /* The search match is drawn over the highlighting */
+    if (match_start <= pos && pos < match_end) {
+        *group = HLG_SEARCH;
+        end = match_end;
+    } else if (pos < match_start && match_start < end)
+        end = match_start;
+
+    return end < length ? end : length;
 }
 
-void hl_wprintw(WINDOW * win, const char *line, int width, int offset)
+void hl_wprintw(WINDOW * win, const char *line, const struct hl_line *hl,
+        int width, int offset, int match_start, int match_end)
 {
     int length;                 /* Length of the line passed in */
-    enum hl_group_kind color;   /* Color used to print current char */
-    int i;                      /* Loops through the line char by char */
-    int j;                      /* General iterator */
+    enum hl_group_kind color;   /* Color used to print current run */
+    int i;                      /* Position of the next char in the line */
+    int end;                    /* Position after the current run */
+    int next;                   /* Position of the next tab in the run */
+    int column;                 /* Column of the next char, before scrolling */
+    int span;                   /* Index of the current span */
     int p;                      /* Count of chars printed to screen */
-    int pad;                    /* Used to pad partial tabs */
+    int skip;                   /* Chars of a piece scrolled off the screen */
     int attr;                   /* A temp variable used for attributes */
     int highlight_tabstop = cgdbrc_get(CGDBRC_TABSTOP)->variant.int_val;
 
-    /* Jump ahead to the character at offset (process color commands too) */
     length = strlen(line);
-    color = HLG_TEXT;
-
-    for (i = 0, j = 0; i < length && j < offset; i++) {
-        if (line[i] == HL_CHAR && i + 1 < length) {
-            /* Even though we're not printing anything in this loop,
-             * the color attribute needs to be maintained for when we
-             * start printing in the loop below.  This way the text
-             * printed will be done in the correct color. */
-            color = (int) line[++i];
-        } else if (line[i] == '\t') {
-            /* Tab character, expand to size set by user */
-            j += highlight_tabstop - (j % highlight_tabstop);
-        } else {
-            /* Normal character, just increment counter by one */
-            j++;
+
+    for (i = 0, column = 0, span = 0, p = 0; i < length && p < width;) {
+        end = hl_next_run(hl, &span, i, length, match_start, match_end,
+                &color);
+
+        if (hl_groups_get_attr(hl_groups_instance, color, &attr) == -1) {
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "hl_groups_get_attr error");
+            return;
         }
-    }
-    pad = j - offset;
 
-    /* Pad tab spaces if offset is less than the size of a tab */
-    for (j = 0, p = 0; j < pad && p < width; j++, p++)
-        wprintw(win, " ");
+        wattron(win, attr);
 
-    /* Set the color appropriately */
-    if (hl_groups_get_attr(hl_groups_instance, color, &attr) == -1) {
-        logger_write_pos(logger, __FILE__, __LINE__,
-                "hl_groups_get_attr error");
-        return;
-    }
+        /* Print the run a piece at a time, the tabs are expanded */
+        while (i < end && p < width) {
+            if (line[i] == '\t') {
+                /* Tab character, expand to size set by user */
+                do {
+                    if (column >= offset && p < width) {
+                        waddch(win, ' ');
+                        p++;
+                    }
+                    column++;
+                } while (column % highlight_tabstop > 0);
+                i++;
+                continue;
+            }
 
-    wattron(win, attr);
+            for (next = i; next < end && line[next] != '\t'; next++);
 
-    /* Print string 1 char at a time */
-    for (; i < length && p < width; i++) {
-        if (line[i] == HL_CHAR) {
-            if (++i < length) {
-                wattroff(win, attr);
-                color = (int) line[i];
+            skip = offset - column;
+            if (skip < 0)
+                skip = 0;
 
-                if (hl_groups_get_attr(hl_groups_instance, color, &attr) == -1) {
-                    logger_write_pos(logger, __FILE__, __LINE__,
-                            "hl_groups_get_attr error");
-                    return;
-                }
+            if (skip < next - i) {
+                int n = next - i - skip;
 
-                wattron(win, attr);
-            }
-        } else {
-            switch (line[i]) {
-                case '\t':
-                    do {
-                        wprintw(win, " ");
-                        p++;
-                    } while ((p + offset) % highlight_tabstop > 0 && p < width);
-                    break;
-                default:
-                    wprintw(win, "%c", line[i]);
-                    p++;
+                if (n > width - p)
+                    n = width - p;
+
+                waddnstr(win, line + i + skip, n);
+                p += n;
             }
+
+            column += next - i;
+            i = next;
         }
-    }
 
-    /* Shut off color attribute */
-    wattroff(win, attr);
+        wattroff(win, attr);
+    }
 
     for (; p < width; p++)
-        wprintw(win, " ");
+        waddch(win, ' ');
 }
 
-int hl_regex(const char *regex, const char **hl_lines, const char **tlines,
-        const int length, char **cur_line, int *sel_line,
+int hl_regex(const char *regex, const char **tlines,
+        const int length, int *sel_col_sbeg, int *sel_col_send, int *sel_line,
         int *sel_rline, int *sel_col_rbeg, int *sel_col_rend,
         int opt, int direction, int icase)
 {
@@ -360,15 +815,12 @@ int hl_regex(const char *regex, const char **hl_lines, const char **tlines,
     int config_wrapscan = cgdbrc_get(CGDBRC_WRAPSCAN)->variant.int_val;
 
     if (tlines == NULL || tlines[0] == NULL ||
-            cur_line == NULL || sel_line == NULL ||
+            sel_col_sbeg == NULL || sel_col_send == NULL || sel_line == NULL ||
             sel_rline == NULL || sel_col_rbeg == NULL || sel_col_rend == NULL)
         return -1;
 
-    /* Clear last highlighted line */
-    if (*cur_line != NULL) {
-        free(*cur_line);
-        *cur_line = NULL;
-    }
+    /* Clear last match */
+    *sel_col_sbeg = *sel_col_send = -1;
 
     /* If regex is empty, set current line to original line */
     if (regex == NULL || *regex == '\0') {
@@ -477,11 +929,11 @@ int hl_regex(const char *regex, const char **hl_lines, const char **tlines,
         /* Keep the new line as the selected line */
         *sel_line = i;
 
-        /* If the match is not perminant then give cur_line highlighting */
-        if (opt != 2 && pmatch[0].rm_so != -1 && pmatch[0].rm_eo != -1)
-            *cur_line =
-                    highlight_line_segment(hl_lines[i],
-                    pmatch[0].rm_so + offset, pmatch[0].rm_eo + offset);
+        /* If the match is not perminant then show it on the line */
+        if (opt != 2 && pmatch[0].rm_so != -1 && pmatch[0].rm_eo != -1) {
+            *sel_col_sbeg = pmatch[0].rm_so + offset;
+            *sel_col_send = pmatch[0].rm_eo + offset;
+        }
     } else {
         /* On failure, the current line goes to the original line */
         *sel_line = *sel_rline;
@@ -20,27 +20,114 @@
 
 /* Local Includes */
 #include "sources.h"
+#include "highlight_groups.h"
+
+/* ----------- */
+/* Definitions */
+/* ----------- */
+
+/* Number of lines between the lexer states remembered for a file */
+#define HL_CHECKPOINT_INTERVAL 256
+
+/* --------------- */
+/* Data Structures */
+/* --------------- */
+
+/* A run of characters in a line that is drawn in one highlighting group.
+ * Characters that are not in any span are drawn as HLG_TEXT. */
+struct hl_span {
+    int start;                  /* Position of the first character */
+    int length;                 /* Number of characters */
+    enum hl_group_kind group;   /* Group the characters are drawn in */
+};
+
+/* The highlighting of a line, which refers to the text in the file buffer */
+struct hl_line {
+    struct hl_span *spans;      /* The spans, in order of position */
+    int length;                 /* Number of spans, -1 if not highlighted */
+};
 
 /* --------- */
 /* Functions */
 /* --------- */
 
-/* highlight:  Inserts the highlighting tags into the buffer.  Lines in
- * ----------  this file should be displayed with hl_wprintw from now on...
+/* highlight:  Prepares the node for highlighting in the node's language.
+ * ----------  No lines are highlighted until highlight_lines asks for them.
+ *             Lines in this file should be displayed with hl_wprintw from
+ *             now on, passing the line's entry of hl_lines when there is one.
  *
  *   node:  The node containing the file buffer to highlight.
  */
 void highlight(struct list_node *node);
 
-/* hl_wprintw:  Prints a given line using the embedded highlighting commands
- * -----------  to dictate how to color the given line.
+/* highlight_free:  Frees the highlighting of a node.
+ * ---------------
+ *
+ *   node:  The node containing the file buffer that was highlighted.
+ */
+void highlight_free(struct list_node *node);
+
+/* highlight_lines:  Finds the highlighting spans of a range of lines.
+ * ----------------  Some lines around the range are highlighted as well, so
+ *                   that scrolling a little does not tokenize again.
+ *                   Tokenizing starts at the closest lexer state remembered
+ *                   before the range, not at the beginning of the file.
+ *
+ *                   When the highlighting thread is running, the lines are
+ *                   only requested from it, and they become available once
+ *                   highlight_worker_collect has been called.
+ *
+ *   node:   The node containing the file buffer to highlight.
+ *   start:  The first line to highlight.
+ *   end:    The line after the last line to highlight.
+ *
+ * Return Value:  The number of lines highlighted by this call.
+ */
+int highlight_lines(struct list_node *node, int start, int end);
+
+/* highlight_forget:  Drops the highlighting requested for a node.
+ * -----------------  This must be called before the node's buffer is
+ *                    released or highlighted again.
+ *
+ *   node:  The node being released.
+ */
+void highlight_forget(struct list_node *node);
+
+/* highlight_worker_start:  Starts the highlighting thread.
+ * -----------------------  Until it is started, or if it can not be,
+ *                          highlight_lines highlights in the caller.
+ *
+ * Return Value:  A descriptor that becomes readable when highlighted lines
+ *                are ready to be collected, or -1 on error.
+ */
+int highlight_worker_start(void);
+
+/* highlight_worker_collect:  Moves the lines highlighted by the thread into
+ * -------------------------  their nodes.
+ *
+ * Return Value:  The number of lines collected, the source window should be
+ *                redrawn when this is not zero.
+ */
+int highlight_worker_collect(void);
+
+/* highlight_worker_stop:  Stops the highlighting thread.
+ * ----------------------
+ */
+void highlight_worker_stop(void);
+
+/* hl_wprintw:  Prints a given line using its highlighting spans to dictate
+ * -----------  how to color the given line.
  *
- *   win:     The ncurses window to which the line will be written
- *   line:    The line to print
- *   width:   The maximum width of a line
- *   offset:  Character (in line) to start at (0..length-1)
+ *   win:          The ncurses window to which the line will be written
+ *   line:         The line to print
+ *   hl:           The highlighting of the line, or NULL for plain text
+ *   width:        The maximum width of a line
+ *   offset:       Character (in line) to start at (0..length-1)
+ *   match_start:  The start of a search match to show, or -1
+ *   match_end:    The end of the search match, or -1
  */
-void hl_wprintw(WINDOW * win, const char *line, int width, int offset);
+void hl_wprintw(WINDOW * win, const char *line, const struct hl_line *hl,
+        int width, int offset, int match_start, int match_end);
 
 /* hl_regex: Matches a regular expression to some lines.
  * ---------
@@ -48,7 +135,9 @@ void hl_wprintw(WINDOW * win, const char *line, int width, int offset);
  *  regex:          The regular expression to match.
  *  tlines:         The lines of text to search.
  *  length:         The number of lines.
- *  cur_line:       This line is returned with highlighting embedded into it.
+ *  sel_col_sbeg:   Returns the beginning index of an incremental match on
+ *                  sel_line, or -1.
+ *  sel_col_send:   Returns the ending index of an incremental match, or -1.
  *  sel_line:       The current line the user is on.
  *  sel_rline:      The current line the regular expression is on.
  *  sel_col_rbeg:   The beggining index of the last match.
@@ -57,7 +146,8 @@ void hl_wprintw(WINDOW * win, const char *line, int width, int offset);
  *  direction:      1 if forward, 0 if reverse
  *  icase:          1 if case insensitive, 0 otherwise
  */
-int hl_regex(const char *regex, const char **highlighted_lines, const char **tlines, const int length, char **cur_line, /* Returns the correct highlighted line */
+int hl_regex(const char *regex, const char **tlines, const int length,
+        int *sel_col_sbeg, int *sel_col_send,
         int *sel_line,          /* Returns new cur line if regex matches */
         int *sel_rline,         /* Used for internal purposes */
         int *sel_col_rbeg,
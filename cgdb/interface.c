@@ -48,6 +48,10 @@
 #include <ctype.h>
 #endif
 
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
 /* Local Includes */
 #include "cgdb.h"
 #include "config.h"
@@ -62,6 +66,7 @@
 #include "highlight.h"
 #include "highlight_groups.h"
 #include "fs_util.h"
+#include "event_loop.h"
 
 /* ----------- */
 /* Prototypes  */
@@ -126,6 +131,12 @@ static int regex_direction_last;
 /* The position of the source file, before regex was applied. */
 static int orig_line_regex;
 
+/* The scroller the regex is being entered for, or NULL for the source */
+static struct scroller *regex_scroller = NULL;
+
+/* Flag: The GDB window was scrolled back, and takes search keys */
+static int gdb_scroll_mode = 0;
+
 static char last_key_pressed = 0;   /* Last key user entered in cgdb mode */
 
 /* The cgdb status bar command */
@@ -140,6 +151,15 @@ enum StatusBarCommandKind {
 
 static enum StatusBarCommandKind sbc_kind;
 
+/* The parts of the screen that need to be redrawn at the next update */
+#define IF_DRAW_ALL (1 << 0)    /* Every window */
+#define IF_DRAW_GDB (1 << 1)    /* The gdb window got new output */
+#define IF_DRAW_TTY (1 << 2)    /* The tty window got new output */
+static int draw_flags = 0;
+
+/* When the terminal was last updated, see if_update */
+static long long last_update;
+
 /* --------------- */
 /* Local Functions */
 /* --------------- */
@@ -409,10 +429,30 @@ void if_display_message(const char *msg, int width, const char *fmt, ...)
     wrefresh(status_win);
 }
 
-/* if_draw: Draws the interface on the screen.
- * --------
+/* if_refresh_focus: Puts the cursor in the focused window.
+ * ----------------
+ *
+ * The cursor is left wherever the last window copied to the screen put it,
+ * so the focused window has to be the last one refreshed.
  */
-void if_draw(void)
+static void if_refresh_focus(void)
+{
+    if (focus == CGDB && get_src_height() > 0)
+        wnoutrefresh(src_win->win);
+    else if (focus == GDB && get_gdb_height() > 0)
+        scr_refresh(gdb_win, 1);
+    else if (focus == TTY && tty_win_on && get_tty_height() > 0)
+        scr_refresh(tty_win, 1);
+    else if (focus == CGDB_STATUS_BAR)
+        update_status_win();
+}
+
+/* if_redraw: Draws the interface to the virtual screen.
+ * ----------
+ *
+ * The terminal is not updated until doupdate is called.
+ */
+static void if_redraw(void)
 {
     /* Only redisplay the filedlg if it is up */
     if (focus == FILE_DLG) {
@@ -423,10 +463,10 @@ void if_draw(void)
     update_status_win();
 
     if (get_src_height() != 0 && get_gdb_height() != 0)
-        wrefresh(status_win);
+        wnoutrefresh(status_win);
 
     if (tty_win_on)
-        wrefresh(tty_status_win);
+        wnoutrefresh(tty_status_win);
 
     if (get_src_height() > 0)
         source_display(src_win, focus == CGDB);
@@ -437,11 +477,55 @@ void if_draw(void)
     if (get_gdb_height() > 0)
         scr_refresh(gdb_win, focus == GDB);
 
-    /* This check is here so that the cursor goes to the 
-     * cgdb window. The cursor would stay in the gdb window 
-     * on cygwin */
-    if (get_src_height() > 0 && focus == CGDB)
-        wrefresh(src_win->win);
+    /* This is here so that the cursor goes to the cgdb window.
+     * The cursor would stay in the gdb window on cygwin */
+    if_refresh_focus();
+}
+
+/* if_draw: Draws the interface on the screen.
+ * --------
+ */
+void if_draw(void)
+{
+    draw_flags |= IF_DRAW_ALL;
+}
+
+int if_update(void)
+{
+    int rate = cgdbrc_get(CGDBRC_FRAMERATE)->variant.int_val;
+    long long now;
+
+    if (!draw_flags || !curses_initialized)
+        return -1;
+
+    now = event_loop_now();
+
+    /* Wait until a whole frame has passed since the last update */
+    if (rate > 0) {
+        long elapsed = now - last_update;
+        long frame = 1000 / rate;
+
+        if (elapsed >= 0 && elapsed < frame)
+            return frame - elapsed;
+    }
+
+    if (draw_flags & IF_DRAW_ALL)
+        if_redraw();
+    else if (focus != FILE_DLG) {
+        if ((draw_flags & IF_DRAW_TTY) && tty_win_on && get_tty_height() > 0)
+            scr_refresh(tty_win, focus == TTY);
+
+        if ((draw_flags & IF_DRAW_GDB) && get_gdb_height() > 0)
+            scr_refresh(gdb_win, focus == GDB);
+
+        if_refresh_focus();
+    }
+
+    doupdate();
+    draw_flags = 0;
+    last_update = now;
+
+    return -1;
 }
 
 /* validate_window_sizes:
@@ -775,6 +859,66 @@ static int tty_input(int key)
     return 0;
 }
 
+/* if_search_regex: Search the window the regex is being entered for.
+ * ----------------
+ *
+ * See source_search_regex for the arguments.
+ */
+static int if_search_regex(const char *regex, int opt, int direction)
+{
+    int regex_icase = cgdbrc_get(CGDBRC_IGNORECASE)->variant.int_val;
+
+    if (regex_scroller)
+        return scr_search_regex(regex_scroller, regex, opt, direction,
+                regex_icase);
+
+    return source_search_regex(src_win, regex, opt, direction, regex_icase);
+}
+
+/* gdb_scroll_input: Handles the search keys of the scrolled back GDB window.
+ * -----------------
+ *
+ *   key:  Keystroke received.
+ *
+ * Return Value:    0 if internal key was used, 
+ *                  1 if input to gdb
+ */
+static int gdb_scroll_input(int key)
+{
+    int regex_icase = cgdbrc_get(CGDBRC_IGNORECASE)->variant.int_val;
+
+    switch (key) {
+        case '/':
+        case '?':
+            regex_cur = ibuf_init();
+            regex_direction_cur = ('/' == key);
+            regex_scroller = gdb_win;
+
+            sbc_kind = SBC_REGEX;
+            if_set_focus(CGDB_STATUS_BAR);
+
+            /* Capturing regular expressions */
+            scr_search_regex_init(gdb_win);
+            break;
+        case 'n':
+            scr_search_regex(gdb_win, ibuf_get(regex_last), 2,
+                    regex_direction_last, regex_icase);
+            break;
+        case 'N':
+            scr_search_regex(gdb_win, ibuf_get(regex_last), 2,
+                    !regex_direction_last, regex_icase);
+            break;
+        default:
+            /* Any other key goes back to typing at the GDB prompt */
+            gdb_scroll_mode = 0;
+            return 1;
+    }
+
+    if_draw();
+
+    return 0;
+}
+
 /* gdb_input: Handles user input to the GDB window.
  * ----------
  *
@@ -790,15 +934,21 @@ static int gdb_input(int key)
     switch (key) {
         case CGDB_KEY_PPAGE:
             scr_up(gdb_win, get_gdb_height() - 1);
+            gdb_scroll_mode = 1;
             break;
         case CGDB_KEY_NPAGE:
             scr_down(gdb_win, get_gdb_height() - 1);
+            /* Back at the prompt, keys are typed to GDB again */
+            if (scr_at_end(gdb_win))
+                gdb_scroll_mode = 0;
             break;
         case CGDB_KEY_F11:
             scr_home(gdb_win);
+            gdb_scroll_mode = 1;
             break;
         case CGDB_KEY_F12:
             scr_end(gdb_win);
+            gdb_scroll_mode = 0;
             break;
 #if 0
             /* I would like to add better support for control-l in the GDB
@@ -835,6 +985,8 @@ static int gdb_input(int key)
         }
 #endif
         default:
+            if (gdb_scroll_mode)
+                return gdb_scroll_input(key);
             return 1;
     }
 
@@ -855,8 +1007,6 @@ static int gdb_input(int key)
  */
 static int status_bar_regex_input(struct sviewer *sview, int key)
 {
-    int regex_icase = cgdbrc_get(CGDBRC_IGNORECASE)->variant.int_val;
-
     /* Flag to indicate we're done with regex mode, need to switch back */
     int done = 0;
 
@@ -871,8 +1021,7 @@ static int status_bar_regex_input(struct sviewer *sview, int key)
             }
             regex_last = ibuf_dup(regex_cur);
             regex_direction_last = regex_direction_cur;
-            source_search_regex(sview, ibuf_get(regex_last), 2,
-                    regex_direction_last, regex_icase);
+            if_search_regex(ibuf_get(regex_last), 2, regex_direction_last);
             if_draw();
             done = 1;
             break;
@@ -883,8 +1032,7 @@ static int status_bar_regex_input(struct sviewer *sview, int key)
                 done = 1;
             } else {
                 ibuf_delchar(regex_cur);
-                source_search_regex(sview, ibuf_get(regex_cur), 1,
-                        regex_direction_cur, regex_icase);
+                if_search_regex(ibuf_get(regex_cur), 1, regex_direction_cur);
                 if_draw();
                 update_status_win();
             }
@@ -899,8 +1047,7 @@ static int status_bar_regex_input(struct sviewer *sview, int key)
             } else {
                 ibuf_addchar(regex_cur, key);
             }
-            source_search_regex(sview, ibuf_get(regex_cur), 1,
-                    regex_direction_cur, regex_icase);
+            if_search_regex(ibuf_get(regex_cur), 1, regex_direction_cur);
             if_draw();
             update_status_win();
     };
@@ -908,7 +1055,13 @@ static int status_bar_regex_input(struct sviewer *sview, int key)
     if (done) {
         ibuf_free(regex_cur);
         regex_cur = NULL;
-        if_set_focus(CGDB);
+
+        /* Go back to the window that was searched */
+        if (regex_scroller) {
+            regex_scroller = NULL;
+            if_set_focus(GDB);
+        } else
+            if_set_focus(CGDB);
     }
 
     return 0;
@@ -1196,8 +1349,11 @@ int internal_if_input(int key)
     /* Normally, CGDB_KEY_ESC, but can be configured by the user */
     int cgdb_mode_key = cgdbrc_get(CGDBRC_CGDB_MODE_KEY)->variant.int_val;
 
+    /* The file dialog gets every key while the user types a regex */
+    int filedlg_searching = (focus == FILE_DLG && filedlg_is_searching(fd));
+
     /* The cgdb mode key, puts the debugger into command mode */
-    if (focus != CGDB && key == cgdb_mode_key) {
+    if (focus != CGDB && key == cgdb_mode_key && !filedlg_searching) {
         /* Depending on which cgdb was in, it can free some memory here that
          * it was previously using. */
         if (focus == CGDB_STATUS_BAR && sbc_kind == SBC_NORMAL) {
@@ -1206,16 +1362,21 @@ int internal_if_input(int key)
         } else if (focus == CGDB_STATUS_BAR && sbc_kind == SBC_REGEX) {
             ibuf_free(regex_cur);
             regex_cur = NULL;
-            free(src_win->cur->buf.cur_line);
-            src_win->cur->buf.cur_line = NULL;
-            src_win->cur->sel_rline = orig_line_regex;
-            src_win->cur->sel_line = orig_line_regex;
+            if (regex_scroller) {
+                /* Show the GDB window where the search started */
+                if_search_regex(NULL, 1, regex_direction_cur);
+                regex_scroller = NULL;
+            } else {
+                src_win->cur->sel_col_sbeg = src_win->cur->sel_col_send = -1;
+                src_win->cur->sel_rline = orig_line_regex;
+                src_win->cur->sel_line = orig_line_regex;
+            }
         }
         if_set_focus(CGDB);
         return 0;
     }
     /* If you are already in cgdb mode, the cgdb mode key does nothing */
-    else if (key == cgdb_mode_key)
+    else if (key == cgdb_mode_key && !filedlg_searching)
         return 0;
 
     /* Check for global keystrokes */
@@ -1400,27 +1561,17 @@ void if_tty_print(const char *buf)
     scr_add(tty_win, buf);
 
     /* Only need to redraw if tty_win is being displayed */
-    if (tty_win_on && get_gdb_height() > 0) {
-        scr_refresh(tty_win, focus == TTY);
-
-        /* Make sure cursor reappears in source window if focus is there */
-        if (focus == CGDB)
-            wrefresh(src_win->win);
-    }
+    if (tty_win_on)
+        draw_flags |= IF_DRAW_TTY;
 }
 
 void if_print(const char *buf)
 {
-    /* Print it to the scroller */
+    /* Print it to the scroller, this scrolls to the end of the output */
     scr_add(gdb_win, buf);
+    gdb_scroll_mode = 0;
 
-    if (get_gdb_height() > 0) {
-        scr_refresh(gdb_win, focus == GDB);
-
-        /* Make sure cursor reappears in source window if focus is there */
-        if (focus == CGDB)
-            wrefresh(src_win->win);
-    }
+    draw_flags |= IF_DRAW_GDB;
 }
 
 void if_print_message(const char *fmt, ...)
@@ -1503,6 +1654,10 @@ void if_shutdown(void)
 
 void if_set_focus(Focus f)
 {
+    /* The file dialog covered the source window */
+    if (focus == FILE_DLG && f != FILE_DLG && src_win)
+        source_damage(src_win);
+
     switch (f) {
         case GDB:
             focus = f;
@@ -1548,6 +1703,7 @@ void if_highlight_sviewer(enum tokenizer_language_support l)
     if (src_win->cur) {
         src_win->cur->language = l;
         highlight(src_win->cur);
+        source_damage(src_win);
         if_draw();
     }
 }
@@ -158,11 +158,23 @@ void if_search_next(void);
  */
 void if_tty_toggle(void);
 
-/* if_draw:
+/* if_draw: Redraws the whole interface at the next update.
  * -----------
  */
 void if_draw(void);
 
+/* if_update: Brings the terminal up to date with the interface.
+ * ----------
+ *
+ * Everything drawn since the last update is sent to the terminal at once.
+ * The terminal is updated at most framerate times a second, so output that
+ * arrives in bursts is drawn once for the whole burst.
+ *
+ * Return Value: -1 if there is nothing left to draw, otherwise the number
+ *               of milliseconds to wait before calling if_update again.
+ */
+int if_update(void);
+
  /* if_set_winsplit:
   * ________________
   */
@@ -24,89 +24,485 @@
 #include <string.h>
 #endif /* HAVE_STRING_H */
 
+#if HAVE_REGEX_H
+#include <regex.h>
+#endif /* HAVE_REGEX_H */
+
 /* Local Includes */
 #include "cgdb.h"
+#include "cgdbrc.h"
+#include "highlight_groups.h"
 #include "scroller.h"
 
+/* --------------- */
+/* Data Structures */
+/* --------------- */
+
+/* Finished lines are packed into chunks of at least this many bytes */
+#define SCROLLER_CHUNK_SIZE 65536
+
+/* A block of memory holding finished lines, in the order they were added.
+ * Lines leave the scroller in the same order, so a chunk is released once
+ * the last line in it has been dropped. */
+struct scroller_chunk {
+    struct scroller_chunk *next;    /* The next newer chunk */
+    int size;                   /* Number of bytes in data */
+    int used;                   /* Number of bytes given out */
+    int lines;                  /* Number of lines still using the chunk */
+    char *data;
+};
+
+/* A match of the search regex. Lines are counted from the first line ever
+ * added to the scroller, so matches stay valid when old lines are dropped. */
+struct scroller_match {
+    long line;                  /* The line of the match */
+    int begin;                  /* Index in the line where the match starts */
+    int end;                    /* Index just past the end of the match */
+};
+
+struct scroller_search {
+    char *regex;                /* The regex matches were found for, or NULL */
+    int icase;                  /* If regex ignores case */
+    regex_t t;                  /* The compiled regex */
+    const char *literal;        /* Text every match starts with, in regex */
+    int literal_length;         /* Length of literal, 0 if there is none */
+
+    struct scroller_match *matches; /* Matches in the finished lines */
+    int length;                 /* Number of matches */
+    int capacity;               /* Number of matches there is room for */
+    int first;                  /* First match in a line still in the ring */
+    long scanned;               /* Lines before this one have been searched */
+
+    struct scroller_match origin;   /* The next search starts after this */
+    struct scroller_match shown;    /* The match being shown, or line -1 */
+    long view_line;             /* The view when the search was started */
+    int view_c;
+};
+
 /* --------------- */
 /* Local Functions */
 /* --------------- */
 
-/* count: Count the occurrences of a character c in a string s.
- * ------
+/* chunk_store: Copy a finished line into the chunk arena.
+ * ------------
  *
- *   s:  String to search
- *   c:  Character to search for
+ *   scr:     Pointer to the scroller object
+ *   text:    The line
+ *   length:  Length of text
  *
- * Return Value:  Number of occurrences of c in s.
+ * Return Value:  The copy of text.
  */
-static int count(const char *s, char c)
+static char *chunk_store(struct scroller *scr, const char *text, int length)
 {
-    int rv = 0;
-    char *x = strchr(s, c);
-
-    while (x) {
-        rv++;
-        x = strchr(x + 1, c);
+    struct scroller_chunk *chunk = scr->last_chunk;
+    char *rv;
+
+    if (!chunk || chunk->size - chunk->used < length + 1) {
+        int size = SCROLLER_CHUNK_SIZE;
+
+        if (size < length + 1)
+            size = length + 1;
+
+        chunk = malloc(sizeof (struct scroller_chunk) + size);
+        chunk->next = NULL;
+        chunk->size = size;
+        chunk->used = 0;
+        chunk->lines = 0;
+        chunk->data = (char *) (chunk + 1);
+
+        if (scr->last_chunk)
+            scr->last_chunk->next = chunk;
+        else
+            scr->first_chunk = chunk;
+        scr->last_chunk = chunk;
     }
 
+    rv = chunk->data + chunk->used;
+    memcpy(rv, text, length);
+    rv[length] = 0;
+    chunk->used += length + 1;
+    chunk->lines++;
+
     return rv;
 }
 
+/* chunk_release: Forget the oldest line stored in the chunk arena.
+ * --------------
+ *
+ *   scr:  Pointer to the scroller object
+ */
+static void chunk_release(struct scroller *scr)
+{
+    struct scroller_chunk *chunk = scr->first_chunk;
+
+    if (--chunk->lines > 0)
+        return;
+
+    /* The newest chunk is kept and filled again from the start */
+    if (chunk == scr->last_chunk) {
+        chunk->used = 0;
+        return;
+    }
+
+    scr->first_chunk = chunk->next;
+    free(chunk);
+}
+
+/* scr_line: Get a line of the buffer.
+ * ---------
+ *
+ *   scr:  Pointer to the scroller object
+ *   r:    The line number, 0 is the oldest line
+ *
+ * Return Value:  The slot in the ring holding line r.
+ */
+static struct scroller_line *scr_line(struct scroller *scr, int r)
+{
+    return &scr->buffer[(scr->start + r) % scr->capacity];
+}
+
+/* scr_new_line: Finish the last line and start a new, empty one.
+ * -------------
+ *
+ * The finished line is moved to the chunk arena. The buffer grows
+ * geometrically until it holds scrollbackbuffersize lines, after that the
+ * oldest line is dropped to make room.
+ *
+ *   scr:  Pointer to the scroller object
+ */
+static void scr_new_line(struct scroller *scr)
+{
+    int limit =
+            cgdbrc_get(CGDBRC_SCROLLBACK_BUFFER_SIZE)->variant.int_val;
+    struct scroller_line *line = scr_line(scr, scr->length - 1);
+
+    line->text = chunk_store(scr, scr->last.text, scr->last.length);
+
+    /* Drop the oldest lines, the limit may have been lowered */
+    while (scr->length > 0 && scr->length >= limit) {
+        chunk_release(scr);
+        scr->start = (scr->start + 1) % scr->capacity;
+        scr->length--;
+        scr->dropped++;
+
+        /* Keep the view on the same text */
+        if (scr->current.r > 0)
+            scr->current.r--;
+        else
+            scr->current.c = 0;
+    }
+
+    if (scr->length == scr->capacity) {
+        int capacity = scr->capacity * 2;
+        struct scroller_line *buffer;
+        int i;
+
+        if (capacity > limit)
+            capacity = limit;
+
+        /* Unwrap the ring into the new buffer */
+        buffer = malloc(sizeof (struct scroller_line) * capacity);
+        for (i = 0; i < scr->length; i++)
+            buffer[i] = *scr_line(scr, i);
+
+        free(scr->buffer);
+        scr->buffer = buffer;
+        scr->capacity = capacity;
+        scr->start = 0;
+    }
+
+    scr->last.length = 0;
+    scr->last.text[0] = 0;
+    scr->current.pos = 0;
+
+    line = scr_line(scr, scr->length);
+    line->text = scr->last.text;
+    line->length = 0;
+    scr->length++;
+}
+
+/* last_put: Write a character to the last line at the cursor.
+ * ---------
+ *
+ *   scr:  Pointer to the scroller object
+ *   c:    The character to write
+ */
+static void last_put(struct scroller *scr, char c)
+{
+    int i = scr->current.pos;
+
+    /* Grow geometrically, leaving room for the terminating NUL */
+    if (i + 1 >= scr->last.size) {
+        scr->last.size *= 2;
+        scr->last.text = realloc(scr->last.text, scr->last.size);
+    }
+
+    scr->last.text[i] = c;
+    scr->current.pos = i + 1;
+    if (scr->current.pos > scr->last.length) {
+        scr->last.length = scr->current.pos;
+        scr->last.text[scr->last.length] = 0;
+    }
+}
+
 /* parse: Translates special characters in a string.  (i.e. backspace, tab...)
  * ------
  *
- *   buf:  The string to parse
+ * The result is written in place into the last line of the buffer.
  *
- * Return Value:  A newly allocated copy of buf, with modifications made.
+ *   scr:     Pointer to the scroller object
+ *   buf:     The string to parse
+ *   length:  Number of characters of buf to parse
  */
-static char *parse(struct scroller *scr, const char *orig, const char *buf)
+static void parse(struct scroller *scr, const char *buf, int length)
 {
     const int tab_size = 8;
-    int length = strlen(orig) + strlen(buf) + (tab_size - 1) * count(buf, '\t');
-    char *rv = (char *) malloc(length + 1);
-    int i, j;
-
-    /* Zero out the string */
-    memset(rv, 0, length + 1);
-    strcpy(rv, orig);
-    i = scr->current.pos;
+    struct scroller_line *line;
+    int j;
 
     /* Expand special characters */
-    for (j = 0; j < strlen(buf); j++) {
+    for (j = 0; j < length; j++) {
         switch (buf[j]) {
                 /* Backspace/Delete -> Erase last character */
             case 8:
             case 127:
-                if (i > 0)
-                    i--;
+                if (scr->current.pos > 0)
+                    scr->current.pos--;
                 break;
                 /* Tab -> Translating to spaces */
             case '\t':
                 do
-                    rv[i++] = ' ';
-                while (i % tab_size != 0);
+                    last_put(scr, ' ');
+                while (scr->current.pos % tab_size != 0);
                 break;
                 /* Carriage return -> Move back to the beginning of the line */
             case '\r':
-                i = 0;
+                scr->current.pos = 0;
                 break;
                 /* Default case -> Only keep printable characters */
             default:
-                if (isprint((int) buf[j])) {
-                    rv[i] = buf[j];
-                    i++;
-                }
+                if (isprint((int) buf[j]))
+                    last_put(scr, buf[j]);
                 break;
         }
     }
 
-    scr->current.pos = i;
     /* Remove trailing space from the line */
-    for (j = strlen(rv) - 1; j > i && isspace((int) rv[j]); j--);
-    rv[j + 1] = 0;
+    for (j = scr->last.length - 1;
+            j > scr->current.pos && isspace((int) scr->last.text[j]); j--);
+    if (j + 1 < scr->last.length) {
+        scr->last.length = j + 1;
+        scr->last.text[scr->last.length] = 0;
+    }
+
+    line = scr_line(scr, scr->length - 1);
+    line->text = scr->last.text;
+    line->length = scr->last.length;
+}
+
+/* search_literal: Find the text every match of a regex starts with.
+ * ---------------
+ *
+ * Lines without this text can be skipped without running the regex.
+ *
+ *   regex:    The basic regular expression
+ *   icase:    1 if the regex ignores case
+ *   literal:  Returns where the text starts in regex
+ *
+ * Return Value:  The length of the text, 0 if there is none.
+ */
+static int search_literal(const char *regex, int icase, const char **literal)
+{
+    int n;
+
+    /* An alternative does not have to start with the same text */
+    if (strstr(regex, "\\|"))
+        return 0;
+
+    if (*regex == '^')
+        regex++;
+
+    for (n = 0; regex[n] && !strchr(".[*^$\\", regex[n]); n++) {
+        if (icase && isalpha((unsigned char) regex[n]))
+            break;
+    }
+
+    /* A repetition may make the character before it optional */
+    if (n > 0 && (regex[n] == '*' || regex[n] == '\\'))
+        n--;
+
+    *literal = regex;
+    return n;
+}
+
+/* search_find_literal: Find the search literal in some text.
+ * --------------------
+ *
+ *   search:  The search state
+ *   text:    The text to look in
+ *   length:  Length of text
+ *
+ * Return Value:  The first occurrence of the literal, or NULL.
+ */
+static const char *search_find_literal(struct scroller_search *search,
+        const char *text, int length)
+{
+    const char *end = text + length - search->literal_length;
+
+    while (text <= end) {
+        text = memchr(text, search->literal[0], end - text + 1);
+        if (!text)
+            break;
+        if (memcmp(text, search->literal, search->literal_length) == 0)
+            return text;
+        text++;
+    }
+
+    return NULL;
+}
+
+/* search_line: Add the matches in a line to the list of matches.
+ * ------------
+ *
+ *   search:  The search state
+ *   id:      The number of the line, counted from the first line ever added
+ *   line:    The line to search
+ */
+static void search_line(struct scroller_search *search, long id,
+        const struct scroller_line *line)
+{
+    regmatch_t pmatch[1];
+    int offset = 0;
+
+    while (offset <= line->length) {
+        struct scroller_match *match;
+
+        /* Skip ahead to where a match could start */
+        if (search->literal_length > 0) {
+            const char *p = search_find_literal(search, line->text + offset,
+                    line->length - offset);
+
+            if (!p)
+                break;
+            offset = p - line->text;
+        }
+
+        if (regexec(&search->t, line->text + offset, 1, pmatch,
+                        offset ? REG_NOTBOL : 0) != 0)
+            break;
+
+        if (search->length == search->capacity) {
+            search->capacity = search->capacity ? search->capacity * 2 : 64;
+            search->matches = realloc(search->matches,
+                    sizeof (struct scroller_match) * search->capacity);
+        }
+
+        match = &search->matches[search->length++];
+        match->line = id;
+        match->begin = offset + pmatch[0].rm_so;
+        match->end = offset + pmatch[0].rm_eo;
+
+        offset = (match->end > match->begin) ? match->end : match->begin + 1;
+    }
+}
+
+/* search_get: Get the search state of a scroller, creating it if needed.
+ * -----------
+ *
+ *   scr:  Pointer to the scroller object
+ *
+ * Return Value:  The search state.
+ */
+static struct scroller_search *search_get(struct scroller *scr)
+{
+    if (!scr->search) {
+        scr->search = calloc(1, sizeof (struct scroller_search));
+        scr_search_regex_init(scr);
+    }
+
+    return scr->search;
+}
+
+/* search_update: Bring the list of matches up to date.
+ * --------------
+ *
+ * The matches of the last line are put after the matches of the finished
+ * lines, but are not kept, since the last line can still change.
+ *
+ *   scr:    Pointer to the scroller object
+ *   regex:  The regular expression
+ *   icase:  1 if case insensitive, 0 otherwise
+ *
+ * Return Value:  The number of matches including the last line,
+ *                or -1 if the regex is invalid.
+ */
+static int search_update(struct scroller *scr, const char *regex, int icase)
+{
+    struct scroller_search *search = search_get(scr);
+    long last = scr->dropped + scr->length - 1;
+    int length, total;
+
+    /* A different regex, start over */
+    if (!search->regex || search->icase != icase ||
+            strcmp(search->regex, regex) != 0) {
+        regex_t t;
 
-    return realloc(rv, strlen(rv) + 1);
+        if (regcomp(&t, regex, icase ? REG_ICASE : 0) != 0)
+            return -1;
+
+        if (search->regex) {
+            regfree(&search->t);
+            free(search->regex);
+        }
+        search->t = t;
+        search->regex = strdup(regex);
+        search->icase = icase;
+        search->literal_length =
+                search_literal(search->regex, icase, &search->literal);
+        search->length = 0;
+        search->first = 0;
+        search->scanned = scr->dropped;
+    }
+
+    /* Forget the matches in lines that were dropped */
+    while (search->first < search->length &&
+            search->matches[search->first].line < scr->dropped)
+        search->first++;
+
+    if (search->first > search->length / 2) {
+        search->length -= search->first;
+        memmove(search->matches, search->matches + search->first,
+                sizeof (struct scroller_match) * search->length);
+        search->first = 0;
+    }
+
+    /* Search the lines finished since the last time */
+    if (search->scanned < scr->dropped)
+        search->scanned = scr->dropped;
+    for (; search->scanned < last; search->scanned++)
+        search_line(search, search->scanned,
+                scr_line(scr, search->scanned - scr->dropped));
+
+    length = search->length;
+    search_line(search, last, scr_line(scr, scr->length - 1));
+    total = search->length;
+    search->length = length;
+
+    return total;
+}
+
+/* search_compare: Compare the position of a match with another position.
+ * ---------------
+ *
+ * Return Value:  Less than, equal to or greater than 0 if the match is
+ *                before, at or after the position.
+ */
+static int search_compare(const struct scroller_match *match,
+        const struct scroller_match *pos)
+{
+    if (match->line != pos->line)
+        return (match->line < pos->line) ? -1 : 1;
+    return match->begin - pos->begin;
 }
 
 /* ----------------- */
@@ -128,8 +524,19 @@ struct scroller *scr_new(int pos_r, int pos_c, int height, int width)
     rv->win = newwin(height, width, pos_r, pos_c);
 
     /* Start with a single (blank) line */
-    rv->buffer = malloc(sizeof (char *));
-    rv->buffer[0] = strdup("");
+    rv->last.size = 128;
+    rv->last.text = malloc(rv->last.size);
+    rv->last.text[0] = 0;
+    rv->last.length = 0;
+    rv->first_chunk = NULL;
+    rv->last_chunk = NULL;
+    rv->dropped = 0;
+    rv->search = NULL;
+    rv->buffer = malloc(sizeof (struct scroller_line));
+    rv->buffer[0].text = rv->last.text;
+    rv->buffer[0].length = 0;
+    rv->capacity = 1;
+    rv->start = 0;
     rv->length = 1;
 
     return rv;
@@ -137,16 +544,26 @@ struct scroller *scr_new(int pos_r, int pos_c, int height, int width)
 
 void scr_free(struct scroller *scr)
 {
-    int i;
+    struct scroller_chunk *chunk, *next;
 
     /* Release the buffer */
-    if (scr->length) {
-        for (i = 0; i < scr->length; i++)
-            free(scr->buffer[i]);
-        free(scr->buffer);
+    for (chunk = scr->first_chunk; chunk; chunk = next) {
+        next = chunk->next;
+        free(chunk);
     }
+    free(scr->last.text);
+    free(scr->buffer);
     delwin(scr->win);
 
+    if (scr->search) {
+        if (scr->search->regex) {
+            regfree(&scr->search->t);
+            free(scr->search->regex);
+        }
+        free(scr->search->matches);
+        free(scr->search);
+    }
+
     /* Release the scroller object */
     free(scr);
 }
@@ -173,7 +590,7 @@ void scr_up(struct scroller *scr, int nlines)
         else {
             if (scr->current.r > 0) {
                 scr->current.r--;
-                if ((length = strlen(scr->buffer[scr->current.r])) > width)
+                if ((length = scr_line(scr, scr->current.r)->length) > width)
                     scr->current.c = ((length - 1) / width) * width;
             } else {
                 /* At top */
@@ -198,7 +615,7 @@ void scr_down(struct scroller *scr, int nlines)
 
     for (i = 0; i < nlines; i++) {
         /* If the current line wraps to the next, then advance column number */
-        length = strlen(scr->buffer[scr->current.r]);
+        length = scr_line(scr, scr->current.r)->length;
         if (scr->current.c < length - width)
             scr->current.c += width;
 
@@ -228,53 +645,37 @@ void scr_end(struct scroller *scr)
     getmaxyx(scr->win, height, width);
 
     scr->current.r = scr->length - 1;
-    scr->current.c = (strlen(scr->buffer[scr->current.r]) / width) * width;
+    scr->current.c = (scr_line(scr, scr->current.r)->length / width) * width;
+
+    /* The search match is no longer in view */
+    if (scr->search)
+        scr->search->shown.line = -1;
 }
 
-void scr_add(struct scroller *scr, const char *buf)
+int scr_at_end(struct scroller *scr)
 {
-    int distance;               /* Distance to next new line character */
-    int length;                 /* Length of the current line */
-    char *x;                    /* Pointer to next new line character */
-
-    /* Find next newline in the string */
-    x = strchr(buf, '\n');
-    length = strlen(scr->buffer[scr->length - 1]);
-    distance = x ? x - buf : strlen(buf);
-
-    /* Append to the last line in the buffer */
-    if (distance > 0) {
-        char *temp = scr->buffer[scr->length - 1];
-        char *buf2 = malloc(distance + 1);
-
-        strncpy(buf2, buf, distance);
-        buf2[distance] = 0;
-        scr->buffer[scr->length - 1] = parse(scr, temp, buf2);
-        free(temp);
-        free(buf2);
-    }
+    int height, width;
 
-    /* Create additional lines if buf contains newlines */
-    while (x != NULL) {
-        char *newbuf;
+    getmaxyx(scr->win, height, width);
 
-        buf = x + 1;
-        x = strchr(buf, '\n');
-        distance = x ? x - buf : strlen(buf);
+    return scr->current.r >= scr->length - 1 &&
+            scr->current.c >= scr_line(scr, scr->current.r)->length - width;
+}
 
-        /* Create a new buffer that stops at the next newline */
-        newbuf = malloc(distance + 1);
-        memset(newbuf, 0, distance + 1);
-        strncpy(newbuf, buf, distance);
+void scr_add(struct scroller *scr, const char *buf)
+{
+    const char *x;              /* Pointer to next new line character */
 
-        /* Expand the buffer */
-        scr->length++;
-        scr->buffer = realloc(scr->buffer, sizeof (char *) * scr->length);
-        scr->current.pos = 0;
+    for (;;) {
+        /* Append up to the next newline to the last line in the buffer */
+        x = strchr(buf, '\n');
+        parse(scr, buf, x ? x - buf : strlen(buf));
+        if (!x)
+            break;
 
-        /* Add the new line */
-        scr->buffer[scr->length - 1] = parse(scr, "", newbuf);
-        free(newbuf);
+        /* Create an additional line for the text after the newline */
+        scr_new_line(scr);
+        buf = x + 1;
     }
 
     scr_end(scr);
@@ -287,6 +688,96 @@ void scr_move(struct scroller *scr, int pos_r, int pos_c, int height, int width)
     wclear(scr->win);
 }
 
+void scr_search_regex_init(struct scroller *scr)
+{
+    struct scroller_search *search = search_get(scr);
+
+    search->view_line = scr->dropped + scr->current.r;
+    search->view_c = scr->current.c;
+
+    /* Matches on the bottom line count as being after the start */
+    search->origin.line = search->view_line;
+    search->origin.begin = -1;
+    search->origin.end = -1;
+    search->shown.line = -1;
+}
+
+int scr_search_regex(struct scroller *scr, const char *regex, int opt,
+        int direction, int icase)
+{
+    int config_wrapscan = cgdbrc_get(CGDBRC_WRAPSCAN)->variant.int_val;
+    struct scroller_search *search = search_get(scr);
+    struct scroller_match *match = NULL;
+    int height, width;
+    int lo, hi, mid;
+    int total;
+
+    getmaxyx(scr->win, height, width);
+
+    search->shown.line = -1;
+
+    /* If regex is empty, go back to where the search started */
+    if (regex == NULL || *regex == '\0') {
+        if (search->view_line >= scr->dropped) {
+            scr->current.r = search->view_line - scr->dropped;
+            scr->current.c = search->view_c;
+        } else {
+            scr->current.r = 0;
+            scr->current.c = 0;
+        }
+        return 0;
+    }
+
+    total = search_update(scr, regex, icase);
+    if (total == -1)
+        return -1;
+
+    /* Find the first match after the origin */
+    lo = search->first;
+    hi = total;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (search_compare(&search->matches[mid], &search->origin) > 0)
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    if (direction) {
+        if (lo < total)
+            match = &search->matches[lo];
+        else if (config_wrapscan && search->first < total)
+            match = &search->matches[search->first];
+    } else {
+        /* Step back over the matches at the origin */
+        while (lo > search->first &&
+                search_compare(&search->matches[lo - 1], &search->origin) >= 0)
+            lo--;
+
+        if (lo > search->first)
+            match = &search->matches[lo - 1];
+        else if (config_wrapscan && search->first < total)
+            match = &search->matches[total - 1];
+    }
+
+    if (!match) {
+        /* On failure, the view goes back to where the search started */
+        if (opt != 2)
+            scr_search_regex(scr, NULL, opt, direction, icase);
+        return 0;
+    }
+
+    search->shown = *match;
+    if (opt == 2)
+        search->origin = *match;
+
+    /* Show the match on the bottom line of the window */
+    scr->current.r = match->line - scr->dropped;
+    scr->current.c = (match->begin / width) * width;
+
+    return 1;
+}
+
 void scr_refresh(struct scroller *scr, int focus)
 {
     int length;                 /* Length of current line */
@@ -295,10 +786,17 @@ void scr_refresh(struct scroller *scr, int focus)
     int c;                      /* Current column in row */
     int width, height;          /* Width and height of window */
     char *buffer;               /* Current line segment to print */
+    struct scroller_match *shown = NULL;    /* The search match to show */
+    int attr = 0;
 
     /* Sanity check */
     getmaxyx(scr->win, height, width);
 
+    if (scr->search && scr->search->shown.line != -1) {
+        shown = &scr->search->shown;
+        hl_groups_get_attr(hl_groups_instance, HLG_SEARCH, &attr);
+    }
+
     if (scr->current.c > 0) {
         if (scr->current.c % width != 0)
             scr->current.c = (scr->current.c / width) * width;
@@ -314,25 +812,37 @@ void scr_refresh(struct scroller *scr, int focus)
         /* Print the current line [segment] */
         memset(buffer, ' ', width);
         if (r >= 0) {
-            length = strlen(scr->buffer[r] + c);
-            memcpy(buffer, scr->buffer[r] + c, length < width ? length : width);
+            struct scroller_line *line = scr_line(scr, r);
+
+            length = line->length - c;
+            memcpy(buffer, line->text + c, length < width ? length : width);
         }
         mvwprintw(scr->win, height - nlines, 0, "%s", buffer);
 
+        /* Mark the part of the search match on this row */
+        if (shown && r >= 0 && shown->line == scr->dropped + r) {
+            int begin = (shown->begin > c) ? shown->begin : c;
+            int end = (shown->end < c + width) ? shown->end : c + width;
+
+            if (begin < end)
+                mvwchgat(scr->win, height - nlines, begin - c, end - begin,
+                        attr, PAIR_NUMBER(attr), NULL);
+        }
+
         /* Update our position */
         if (c >= width)
             c -= width;
         else {
             r--;
             if (r >= 0) {
-                length = strlen(scr->buffer[r]);
+                length = scr_line(scr, r)->length;
                 if (length > width)
                     c = ((length - 1) / width) * width;
             }
         }
     }
 
-    length = strlen(scr->buffer[scr->current.r] + scr->current.c);
+    length = scr_line(scr, scr->current.r)->length - scr->current.c;
     if (focus && scr->current.r == scr->length - 1 && length <= width) {
         /* We're on the last line, draw the cursor */
         curs_set(1);
@@ -343,5 +853,5 @@ void scr_refresh(struct scroller *scr, int focus)
     }
 
     free(buffer);
-    wrefresh(scr->win);
+    wnoutrefresh(scr->win);
 }
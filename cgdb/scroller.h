@@ -24,9 +24,28 @@
 /* Data Structures */
 /* --------------- */
 
+struct scroller_chunk;
+struct scroller_search;
+
+struct scroller_line {
+    char *text;                 /* The line, NUL terminated */
+    int length;                 /* Length of text, for wrapping it */
+};
+
 struct scroller {
-    char **buffer;              /* The text buffer */
+    struct scroller_line *buffer;   /* The text buffer, a ring of lines */
+    int capacity;               /* Number of lines buffer has room for */
+    int start;                  /* Index in buffer of the first line */
     int length;                 /* Number of lines in buffer */
+    struct {
+        char *text;             /* The last line, still being written to */
+        int length;             /* Length of text */
+        int size;               /* Number of bytes allocated for text */
+    } last;
+    struct scroller_chunk *first_chunk; /* Finished lines, oldest first */
+    struct scroller_chunk *last_chunk;  /* Where new lines are copied to */
+    long dropped;               /* Number of lines dropped from the ring */
+    struct scroller_search *search;     /* Regex search state, or NULL */
     struct {
         int r;                  /* Current line (row) number */
         int c;                  /* Current column number */
@@ -88,9 +107,21 @@ void scr_home(struct scroller *scr);
  */
 void scr_end(struct scroller *scr);
 
+/* scr_at_end: Check if the bottom line of the buffer is in view
+ * -----------
+ *
+ *   scr:  Pointer to the scroller object
+ *
+ * Return Value: 1 if the scroller shows the end of the buffer, 0 otherwise.
+ */
+int scr_at_end(struct scroller *scr);
+
 /* scr_add:  Append a string to the buffer.
  * --------
  *
+ * Once the buffer holds scrollbackbuffersize lines, the oldest line is
+ * dropped for every new one.
+ *
  *   scr:  Pointer to the scroller object
  *   buf:  Buffer to append -- \b characters will be treated as backspace!
  */
@@ -108,9 +139,38 @@ void scr_add(struct scroller *scr, const char *buf);
 void scr_move(struct scroller *scr,
         int pos_r, int pos_c, int height, int width);
 
+/* scr_search_regex_init: Start a new search from the bottom line shown.
+ * ----------------------
+ *
+ *   scr:  Pointer to the scroller object
+ */
+void scr_search_regex_init(struct scroller *scr);
+
+/* scr_search_regex: Search the buffer for a regular expression.
+ * -----------------
+ *
+ * The search starts at the last permanent match, or where
+ * scr_search_regex_init was called. The view is moved to show the match.
+ * The matches of the finished lines are kept, so repeating a search with
+ * the same regex only has to look at the lines added since.
+ *
+ *   scr:        Pointer to the scroller object
+ *   regex:      The regular expression, if NULL or empty the view goes back
+ *               to where the search started
+ *   opt:        1 -> incremental match, 2 -> permanent match
+ *   direction:  1 if forward, 0 if reverse
+ *   icase:      1 if case insensitive, 0 otherwise
+ *
+ * Return Value: 1 if a match was found, 0 if not, -1 on error.
+ */
+int scr_search_regex(struct scroller *scr, const char *regex, int opt,
+        int direction, int icase);
+
 /* scr_refresh: Refreshes the scroller on the screen, in case the caller
  * ------------ damages the screen area where the scroller is written (or,
  *              perhaps the terminal size has changed, and you wish to redraw).
+ *              The window is copied to the virtual screen, the terminal is
+ *              changed at the next doupdate.
  *
  *   scr:    Pointer to the scroller object
  *   focus:  If the window has focus
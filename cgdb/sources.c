@@ -3,11 +3,11 @@
  * 
  * Source file management routines for the GUI.  Provides the ability to
  * add files to the list, load files, and display within a curses window.
- * Files are buffered in memory when they are displayed, and held in
- * memory for the duration of execution.  If memory consumption becomes a
- * problem, this can be optimized to unload files which have not been
- * displayed recently, or only load portions of large files at once. (May
- * affect syntax hilighting.)
+ * Files are buffered in memory when they are displayed.  When the loaded
+ * files take more memory than the sourcecachesize option allows, the ones
+ * that have not been displayed recently are unloaded again.  Their
+ * breakpoints and selected lines are kept, so they are simply reloaded
+ * the next time they are needed.
  *
  */
 
@@ -44,6 +44,11 @@
 #include <unistd.h>
 #endif /* HAVE_UNISTD_H */
 
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif /* HAVE_FCNTL_H */
+
+
 #if HAVE_CTYPE_H
 #include <ctype.h>
 #endif
@@ -56,9 +61,48 @@
 #include "sys_util.h"
 #include "cgdbrc.h"
 #include "highlight_groups.h"
+#include "std_hash.h"
 
 int sources_syntax_on = 1;
 
+/* What a row of the source window shows, see source_row_get */
+struct source_row {
+    int line;                   /* The line of the file */
+    char breakpt;               /* The breakpoint state of the line */
+    char flags;                 /* SOURCE_ROW_* flags */
+    int match_start;            /* The search match drawn in the line */
+    int match_end;              /* or -1 */
+};
+
+#define SOURCE_ROW_DRAWN 1      /* The row has been drawn */
+#define SOURCE_ROW_EXE 2        /* The line is executing */
+#define SOURCE_ROW_SELECTED 4   /* The line is selected in a focused window */
+#define SOURCE_ROW_HIGHLIGHTED 8    /* The line was drawn highlighted */
+
+/* The settings the source window was last drawn with */
+struct source_frame {
+    struct list_node *node;     /* The file drawn, NULL if none */
+    int top;                    /* The line drawn in the first row */
+    int height;                 /* The number of rows */
+    int width;                  /* The width of the window */
+    int lwidth;                 /* The width of the line numbers */
+    int focus;                  /* If the window had focus */
+    int sel_col;                /* The column the lines start at */
+    int syntax;                 /* If syntax highlighting was on */
+    int tabstop;                /* The tabstop option */
+    int arrowstyle;             /* The arrowstyle option */
+    struct source_row *rows;    /* What each row shows, height of them */
+};
+
+/* The breakpoints set in a file that has no node yet */
+struct pending_breaks {
+    char *breakpts;             /* The state of each line, as in a buffer */
+    int length;                 /* Number of lines in breakpts */
+};
+
+/* Advanced each time a file is used, to find the least recently used one */
+static unsigned long source_clock = 0;
+
 /* --------------- */
 /* Local Functions */
 /* --------------- */
@@ -89,15 +133,7 @@ static int verify_file_exists(const char *path)
 static struct list_node *get_relative_node(struct sviewer *sview,
         const char *lpath)
 {
-
-    struct list_node *cur;
-
-    for (cur = sview->list_head; cur != NULL; cur = cur->next)
-        if (cur->lpath)
-            if (strcmp(lpath, cur->lpath) == 0)
-                return cur;
-
-    return NULL;
+    return std_hash_table_lookup(sview->lpaths, lpath);
 }
 
 /* get_node:  Returns a pointer to the node that matches the given path.
@@ -109,14 +145,7 @@ static struct list_node *get_relative_node(struct sviewer *sview,
  */
 static struct list_node *get_node(struct sviewer *sview, const char *path)
 {
-    struct list_node *cur;
-
-    for (cur = sview->list_head; cur != NULL; cur = cur->next)
-        if (cur->path)
-            if (strcmp(path, cur->path) == 0)
-                return cur;
-
-    return NULL;
+    return std_hash_table_lookup(sview->paths, path);
 }
 
 /**
@@ -156,52 +185,179 @@ static int get_timestamp(const char *path, time_t * timestamp)
 
 static int release_file_buffer(struct buffer *buf)
 {
-    int i;
-
     /* Nothing to free */
     if (!buf)
         return 0;
 
-    for (i = 0; i < buf->length; ++i) {
-        free(buf->tlines[i]);
-        buf->tlines[i] = NULL;
-    }
+    /* Lines that point into the file data are released along with it */
+    free(buf->file_data);
+    buf->file_data = NULL;
+    buf->file_size = 0;
 
     free(buf->tlines);
     buf->tlines = NULL;
-    buf->length = 0;
-    buf->cur_line = NULL;
     buf->max_width = 0;
-    free(buf->breakpts);
-    buf->breakpts = NULL;
 
     return 0;
 }
 
-/** 
- * Remove's the memory related to a file.
+/**
+ * Unloads a file, keeping what is needed to load it again transparently.
+ * The line count and the breakpoints stay with the node.
  *
  * \param node
- * The node who's file buffer data needs to be freed.
+ * The node who's file contents needs to be freed.
  *
  * \return
  * 0 on success, or -1 on error.
  */
-static int release_file_memory(struct list_node *node)
+static int unload_file(struct list_node *node)
 {
     if (!node)
         return -1;
 
+    /* Lines still being highlighted would refer to the freed buffer */
+    highlight_forget(node);
+    highlight_free(node);
+
     /* Free the buffer */
     if (release_file_buffer(&node->buf) == -1)
         return -1;
 
-    if (release_file_buffer(&node->orig_buf) == -1)
+    return 0;
+}
+
+static int pending_breaks_free(void *data)
+{
+    struct pending_breaks *pending = (struct pending_breaks *) data;
+
+    free(pending->breakpts);
+    free(pending);
+
+    return 0;
+}
+
+static int pending_key_free(void *data)
+{
+    free(data);
+
+    return 0;
+}
+
+/** 
+ * Remove's the memory related to a file.
+ *
+ * \param node
+ * The node who's file buffer data needs to be freed.
+ *
+ * \return
+ * 0 on success, or -1 on error.
+ */
+static int release_file_memory(struct list_node *node)
+{
+    if (unload_file(node) == -1)
         return -1;
 
+    free(node->buf.breakpts);
+    node->buf.breakpts = NULL;
+    node->buf.length = 0;
+
+    return 0;
+}
+
+/* read_file_data:  Reads the contents of a file into the buffer's file data.
+ * ---------------
+ *
+ * The file is read into a single block, followed by a NUL terminator.
+ *
+ *   buf:   The buffer to store the file data in
+ *   path:  The path to the file
+ *
+ * Return Value:  Zero on success, non-zero on error.
+ */
+static int read_file_data(struct buffer *buf, const char *path)
+{
+    struct stat st;
+    char *data;
+    size_t size, pos;
+    ssize_t nread;
+    int fd;
+
+    if ((fd = open(path, O_RDONLY)) == -1)
+        return 1;
+
+    if (fstat(fd, &st) == -1) {
+        close(fd);
+        return 1;
+    }
+
+    size = st.st_size;
+    data = cgdb_malloc(size + 1);
+
+    for (pos = 0; pos < size; pos += nread) {
+        nread = read(fd, data + pos, size - pos);
+
+        /* The file may have shrunk since it was stat'ed */
+        if (nread == 0)
+            break;
+
+        if (nread == -1) {
+            free(data);
+            close(fd);
+            return 1;
+        }
+    }
+
+    close(fd);
+    data[pos] = '\0';
+
+    buf->file_data = data;
+    buf->file_size = pos;
+
     return 0;
 }
 
+/* index_file_lines:  Builds the line index of a buffer's file data.
+ * -----------------
+ *
+ * Each line ending is replaced by a NUL terminator, and tlines is pointed
+ * at the start of every line in the file data. For a DOS line ending only
+ * the '\r' is replaced, so that the tokenizer can still tell the two
+ * kinds of line endings apart (see tokenizer_set_buffer).
+ *
+ *   buf:  The buffer with the file data to index
+ */
+static void index_file_lines(struct buffer *buf)
+{
+    char *cur = buf->file_data;
+    char *end = buf->file_data + buf->file_size;
+    char *newline;
+    int capacity = 0, length;
+
+    while (cur < end) {
+        newline = memchr(cur, '\n', end - cur);
+        length = newline ? newline - cur : end - cur;
+
+        /* Handle DOS line endings */
+        if (length > 0 && cur[length - 1] == '\r')
+            cur[--length] = '\0';
+        else if (newline)
+            *newline = '\0';
+
+        if (buf->length == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            buf->tlines = cgdb_realloc(buf->tlines, sizeof (char *) * capacity);
+        }
+
+        buf->tlines[buf->length++] = cur;
+
+        if (length > buf->max_width)
+            buf->max_width = length;
+
+        cur = newline ? newline + 1 : end;
+    }
+}
+
 /* load_file:  Loads the file in the list_node into its memory buffer.
  * ----------
  *
@@ -211,81 +367,165 @@ static int release_file_memory(struct list_node *node)
  */
 static int load_file(struct list_node *node)
 {
-    FILE *file;
-    char line[MAX_LINE];
     int i;
+    int old_length = node->buf.length;
 
+    /* The breakpoints of an unloaded file are kept */
     node->buf.length = 0;
     node->buf.tlines = NULL;
-    node->buf.breakpts = NULL;
-    node->buf.cur_line = NULL;
     node->buf.max_width = 0;
-
-    /* Open file and save in original buffer.
-     * I am not sure if this should be done this way in the future.
-     * Maybe this data should be recieved from flex.
-     */
-    node->orig_buf.length = 0;
-    node->orig_buf.tlines = NULL;
-    node->orig_buf.breakpts = NULL;
-    node->orig_buf.cur_line = NULL;
-    node->orig_buf.max_width = 0;
+    node->buf.file_data = NULL;
+    node->buf.file_size = 0;
 
     /* Stat the file to get the timestamp */
-    if (get_timestamp(node->path, &(node->last_modification)) == -1)
+    if (get_timestamp(node->path, &(node->last_modification)) == -1) {
+        node->buf.length = old_length;
         return 2;
+    }
 
-    if (!(file = fopen(node->path, "r")))
+    if (read_file_data(&node->buf, node->path)) {
+        node->buf.length = old_length;
         return 1;
+    }
 
-    while (!feof(file)) {
-        if (fgets(line, MAX_LINE, file)) {
-            int length = strlen(line);
+    index_file_lines(&node->buf);
+
+    /* A file that was unloaded keeps the language it was displayed with */
+    if (!node->buf.breakpts)
+        node->language =
+                tokenizer_get_default_file_type(strrchr(node->path, '.'));
+
+    /* Prepare the highlighting, the lines are highlighted when displayed */
+    node->hl_lines = NULL;
+    node->hl_checkpoints = NULL;
+    node->hl_checkpoints_length = 0;
+    highlight(node);
+
+    /* Allocate the breakpoints array, or fit the kept one to the file */
+    if (!node->buf.breakpts)
+        old_length = 0;
+    node->buf.breakpts = cgdb_realloc(node->buf.breakpts,
+            sizeof (char) * (node->buf.length + 1));
+    for (i = old_length; i < node->buf.length; i++)
+        node->buf.breakpts[i] = 0;
 
-            if (length > 0) {
-                if (line[length - 1] == '\n')
-                    line[length - 1] = 0;
-                if (line[length - 1] == '\r')
-                    line[length - 1] = 0;
-            }
-            if (strlen(line) > node->orig_buf.max_width)
-                node->orig_buf.max_width = strlen(line);
-
-            /* Inefficient - Reallocates memory at each line */
-            node->orig_buf.length++;
-            node->orig_buf.tlines = realloc(node->orig_buf.tlines,
-                    sizeof (char *) * node->orig_buf.length);
-            node->orig_buf.tlines[node->orig_buf.length - 1] = strdup(line);
+    return 0;
+}
+
+/* source_memory:  The memory used by the loaded contents of a file.
+ * --------------
+ *
+ *   node:  The list node to measure
+ *
+ * Return Value:  The number of bytes, 0 if the file is not loaded.
+ */
+static size_t source_memory(struct list_node *node)
+{
+    if (!node->buf.tlines)
+        return 0;
+
+    return node->buf.file_size +
+            node->buf.length * (sizeof (char *) + sizeof (struct hl_line));
+}
+
+/* source_trim:  Unloads the least recently used files until the loaded
+ * ------------  files fit in the sourcecachesize option.
+ *
+ *   sview:  The source viewer object
+ *   keep:   A file that must stay loaded, besides the displayed one
+ */
+static void source_trim(struct sviewer *sview, struct list_node *keep)
+{
+    size_t limit = (size_t)
+            cgdbrc_get(CGDBRC_SOURCECACHESIZE)->variant.int_val << 20;
+    size_t total = 0;
+    struct list_node *cur, *lru;
+
+    if (limit == 0)
+        return;
+
+    for (cur = sview->list_head; cur != NULL; cur = cur->next)
+        total += source_memory(cur);
+
+    while (total > limit) {
+        lru = NULL;
+        for (cur = sview->list_head; cur != NULL; cur = cur->next) {
+            if (!cur->buf.tlines || cur == sview->cur || cur == keep)
+                continue;
+            if (!lru || cur->last_used < lru->last_used)
+                lru = cur;
         }
+
+        /* Only files in use are left */
+        if (!lru)
+            break;
+
+        total -= source_memory(lru);
+        unload_file(lru);
     }
+}
 
-    fclose(file);
+/* source_load:  Loads a file, if it is not already, and marks it used.
+ * ------------  Other files are unloaded to stay within the cache size.
+ *
+ *   sview:  The source viewer object
+ *   node:   The list node to load
+ *
+ * Return Value:  Zero on success, non-zero on error.
+ */
+static int source_load(struct sviewer *sview, struct list_node *node)
+{
+    int result;
 
-    node->language = tokenizer_get_default_file_type(strrchr(node->path, '.'));
+    node->last_used = ++source_clock;
 
-    /* Add the highlighted lines */
-    if (has_colors()) {
-        highlight(node);
-    } else {
-        /* Just copy the lines from the original buffer if no highlighting 
-         * is possible */
-        int i;
-
-        node->buf.length = node->orig_buf.length;
-        node->buf.max_width = node->orig_buf.max_width;
-        node->buf.tlines = cgdb_malloc(sizeof (char *) * node->orig_buf.length);
-        for (i = 0; i < node->orig_buf.length; i++)
-            node->buf.tlines[i] = cgdb_strdup(node->orig_buf.tlines[i]);
-    }
+    if (node->buf.tlines)
+        return 0;
 
-    /* Allocate the breakpoints array */
-    node->buf.breakpts = malloc(sizeof (char) * node->buf.length);
-    for (i = 0; i < node->buf.length; i++)
-        node->buf.breakpts[i] = 0;
+    if ((result = load_file(node)))
+        return result;
+
+    /* The text of the displayed file may have changed */
+    if (node == sview->cur)
+        source_damage(sview);
+
+    source_trim(sview, node);
 
     return 0;
 }
 
+/* source_print_line:  Prints the text of a line of a file.
+ * ------------------
+ *
+ * The line is drawn with its highlighting when syntax highlighting is on
+ * and the line has been highlighted, and as plain text otherwise. A match
+ * of an incremental search is shown on the selected line.
+ *
+ *   sview:   The current source viewer
+ *   line:    The line number
+ *   width:   The maximum width of the line
+ *   offset:  Character (in line) to start at
+ */
+static void source_print_line(struct sviewer *sview, int line, int width,
+        int offset)
+{
+    struct list_node *node = sview->cur;
+    const struct hl_line *hl = NULL;
+    int match_start = -1, match_end = -1;
+
+    if (sources_syntax_on && node->hl_lines &&
+            node->hl_lines[line].length != -1)
+        hl = &node->hl_lines[line];
+
+    if (line == node->sel_line) {
+        match_start = node->sel_col_sbeg;
+        match_end = node->sel_col_send;
+    }
+
+    hl_wprintw(sview->win, node->buf.tlines[line], hl, width, offset,
+            match_start, match_end);
+}
+
 /* draw_current_line:  Draws the currently executing source line on the screen
  * ------------------  including the user-selected marker (arrow, highlight,
  *                     etc) indicating this is the executing line.
@@ -301,9 +541,7 @@ static void draw_current_line(struct sviewer *sview, int line, int lwidth)
     int height = 0;             /* Height of curses window */
     int width = 0;              /* Width of curses window */
     int i = 0, j = 0;           /* Iterators */
-    struct buffer *buf = NULL;  /* Pointer to the source buffer */
-    char *text = NULL;          /* The current line (highlighted) */
-    char *otext = NULL;         /* The current line (unhighlighted) */
+    char *otext = NULL;         /* The current line */
     unsigned int length = 0;    /* Length of the line */
     int column_offset = 0;      /* Text to skip due to arrow */
     int arrow_attr;
@@ -322,20 +560,7 @@ static void draw_current_line(struct sviewer *sview, int line, int lwidth)
     /* Initialize height and width */
     getmaxyx(sview->win, height, width);
 
-    /* If syntax highlighting is on, point to the colored buffer. */
-    if (sources_syntax_on) {
-        buf = &(sview->cur->buf);
-    } else {
-        buf = &(sview->cur->orig_buf);
-    }
-
-    /* If the current selected line is the line executing, use cur_line */
-    if (line == sview->cur->sel_line && buf->cur_line != NULL) {
-        text = buf->cur_line;
-    } else {
-        text = buf->tlines[line];
-    }
-    otext = sview->cur->orig_buf.tlines[line];
+    otext = sview->cur->buf.tlines[line];
     length = strlen(otext);
 
     /* Draw the appropriate arrow, if applicable */
@@ -399,10 +624,242 @@ static void draw_current_line(struct sviewer *sview, int line, int lwidth)
     }
 
     /* Finally, print the source line */
-    hl_wprintw(sview->win, text, width - lwidth - 2,
+    source_print_line(sview, line, width - lwidth - 2,
             sview->cur->sel_col + column_offset);
 }
 
+/* source_draw_row:  Draws a line of the file in a row of the window.
+ * ----------------
+ *
+ *   sview:   The current source viewer
+ *   row:     The row of the window
+ *   line:    The line of the file, may be outside of the file
+ *   width:   The width of the window
+ *   lwidth:  The width of the line numbers
+ *   focus:   If the window has focus
+ *
+ * Return Value:  Zero on success, -1 on error.
+ */
+static int source_draw_row(struct sviewer *sview, int row, int line,
+        int width, int lwidth, int focus)
+{
+    char fmt[16];
+    int attr = 0, sellineno;
+
+    if (hl_groups_get_attr(hl_groups_instance, HLG_SELECTED_LINE_NUMBER,
+                    &sellineno) == -1)
+        return -1;
+
+    sprintf(fmt, "%%%dd", lwidth);
+
+    wmove(sview->win, row, 0);
+    if (has_colors()) {
+        /* Outside of file, just finish drawing the vertical line */
+        if (line < 0 || line >= sview->cur->buf.length) {
+            int j;
+
+            for (j = 1; j < lwidth; j++)
+                waddch(sview->win, ' ');
+            waddch(sview->win, '~');
+            if (focus)
+                wattron(sview->win, A_BOLD);
+            waddch(sview->win, VERT_LINE);
+            if (focus)
+                wattroff(sview->win, A_BOLD);
+            for (j = 2 + lwidth; j < width; j++)
+                waddch(sview->win, ' ');
+
+            /* Mark the current line with an arrow */
+        } else if (line == sview->cur->exe_line) {
+            switch (sview->cur->buf.breakpts[line]) {
+                case 0:
+                    if (hl_groups_get_attr(hl_groups_instance, HLG_ARROW,
+                                    &attr) == -1)
+                        return -1;
+                    break;
+                case 1:
+                    if (hl_groups_get_attr(hl_groups_instance,
+                                    HLG_ENABLED_BREAKPOINT, &attr) == -1)
+                        return -1;
+                    break;
+                case 2:
+                    if (hl_groups_get_attr(hl_groups_instance,
+                                    HLG_DISABLED_BREAKPOINT, &attr) == -1)
+                        return -1;
+                    break;
+            }
+            wattron(sview->win, attr);
+            wprintw(sview->win, fmt, line + 1);
+            wattroff(sview->win, attr);
+
+            draw_current_line(sview, line, lwidth);
+
+            /* Look for breakpoints */
+        } else if (sview->cur->buf.breakpts[line]) {
+            if (sview->cur->buf.breakpts[line] == 1) {
+                if (hl_groups_get_attr(hl_groups_instance,
+                                HLG_ENABLED_BREAKPOINT, &attr) == -1)
+                    return -1;
+            } else {
+                if (hl_groups_get_attr(hl_groups_instance,
+                                HLG_DISABLED_BREAKPOINT, &attr) == -1)
+                    return -1;
+            }
+            wattron(sview->win, attr);
+            wprintw(sview->win, fmt, line + 1);
+            wattroff(sview->win, attr);
+            if (focus)
+                wattron(sview->win, A_BOLD);
+            waddch(sview->win, VERT_LINE);
+            if (focus)
+                wattroff(sview->win, A_BOLD);
+            waddch(sview->win, ' ');
+
+            source_print_line(sview, line, width - lwidth - 2,
+                    sview->cur->sel_col);
+        }
+        /* Ordinary lines */
+        else {
+            if (focus && sview->cur->sel_line == line)
+                wattron(sview->win, sellineno);
+
+            wprintw(sview->win, fmt, line + 1);
+
+            if (focus && sview->cur->sel_line == line)
+                wattroff(sview->win, sellineno);
+
+            if (focus)
+                wattron(sview->win, A_BOLD);
+            waddch(sview->win, VERT_LINE);
+            if (focus)
+                wattroff(sview->win, A_BOLD);
+            waddch(sview->win, ' ');
+
+            /* No special line information */
+            source_print_line(sview, line, width - lwidth - 2,
+                    sview->cur->sel_col);
+        }
+    } else {
+        wprintw(sview->win, "%s\n", sview->cur->buf.tlines[line]);
+    }
+
+    return 0;
+}
+
+/* source_row_get:  Describes what a row of the window shows.
+ * ---------------
+ *
+ *   sview:  The current source viewer
+ *   line:   The line of the file shown in the row
+ *   focus:  If the window has focus
+ *   row:    Returns the description of the row
+ */
+static void source_row_get(struct sviewer *sview, int line, int focus,
+        struct source_row *row)
+{
+    struct list_node *node = sview->cur;
+
+    row->line = line;
+    row->breakpt = 0;
+    row->flags = SOURCE_ROW_DRAWN;
+    row->match_start = -1;
+    row->match_end = -1;
+
+    if (line < 0 || line >= node->buf.length)
+        return;
+
+    row->breakpt = node->buf.breakpts[line];
+    if (line == node->exe_line)
+        row->flags |= SOURCE_ROW_EXE;
+    if (line == node->sel_line) {
+        if (focus)
+            row->flags |= SOURCE_ROW_SELECTED;
+        row->match_start = node->sel_col_sbeg;
+        row->match_end = node->sel_col_send;
+    }
+    if (node->hl_lines && node->hl_lines[line].length != -1)
+        row->flags |= SOURCE_ROW_HIGHLIGHTED;
+}
+
+/* source_row_equal:  Checks if two rows show the same thing.
+ * -----------------
+ *
+ * Return Value:  1 if they are equal, 0 otherwise.
+ */
+static int source_row_equal(const struct source_row *a,
+        const struct source_row *b)
+{
+    return a->line == b->line && a->breakpt == b->breakpt &&
+            a->flags == b->flags && a->match_start == b->match_start &&
+            a->match_end == b->match_end;
+}
+
+/* source_frame_update:  Compares the window settings with the ones of the
+ * --------------------  last display, and forgets the rows that must all
+ *                       be drawn again.
+ *
+ *   sview:   The current source viewer
+ *   top:     The line shown in the first row
+ *   height:  The height of the window
+ *   width:   The width of the window
+ *   lwidth:  The width of the line numbers
+ *   focus:   If the window has focus
+ */
+static void source_frame_update(struct sviewer *sview, int top, int height,
+        int width, int lwidth, int focus)
+{
+    struct source_frame *frame = sview->frame;
+    struct source_frame now;
+    int delta;
+
+    now.node = sview->cur;
+    now.top = top;
+    now.height = height;
+    now.width = width;
+    now.lwidth = lwidth;
+    now.focus = focus;
+    now.sel_col = sview->cur->sel_col;
+    now.syntax = sources_syntax_on;
+    now.tabstop = cgdbrc_get(CGDBRC_TABSTOP)->variant.int_val;
+    now.arrowstyle = cgdbrc_get(CGDBRC_ARROWSTYLE)->variant.arrow_style;
+    now.rows = frame->rows;
+
+    if (height != frame->height) {
+        now.rows = cgdb_realloc(frame->rows,
+                sizeof (struct source_row) * height);
+        memset(now.rows, 0, sizeof (struct source_row) * height);
+    } else if (now.node != frame->node || width != frame->width ||
+            lwidth != frame->lwidth || focus != frame->focus ||
+            now.sel_col != frame->sel_col || now.syntax != frame->syntax ||
+            now.tabstop != frame->tabstop ||
+            now.arrowstyle != frame->arrowstyle) {
+        memset(now.rows, 0, sizeof (struct source_row) * height);
+    } else if (top != frame->top) {
+        delta = top - frame->top;
+
+        if (delta > -height && delta < height) {
+            /* Move the rows that stay visible instead of drawing them */
+            scrollok(sview->win, TRUE);
+            wscrl(sview->win, delta);
+            scrollok(sview->win, FALSE);
+
+            if (delta > 0) {
+                memmove(now.rows, now.rows + delta,
+                        sizeof (struct source_row) * (height - delta));
+                memset(now.rows + height - delta, 0,
+                        sizeof (struct source_row) * delta);
+            } else {
+                memmove(now.rows - delta, now.rows,
+                        sizeof (struct source_row) * (height + delta));
+                memset(now.rows, 0, sizeof (struct source_row) * -delta);
+            }
+        } else
+            memset(now.rows, 0, sizeof (struct source_row) * height);
+    }
+
+    *frame = now;
+}
+
 /* --------- */
 /* Functions */
 /* --------- */
@@ -419,8 +876,14 @@ struct sviewer *source_new(int pos_r, int pos_c, int height, int width)
 
     /* Initialize the structure */
     rv->win = newwin(height, width, pos_r, pos_c);
+    idlok(rv->win, TRUE);
     rv->cur = NULL;
     rv->list_head = NULL;
+    rv->paths = std_hash_table_new(std_str_hash, std_str_equal);
+    rv->lpaths = std_hash_table_new(std_str_hash, std_str_equal);
+    rv->pending = std_hash_table_new_full(std_str_hash, std_str_equal,
+            pending_key_free, pending_breaks_free);
+    rv->frame = cgdb_calloc(1, sizeof (struct source_frame));
 
     return rv;
 }
@@ -434,13 +897,22 @@ int source_add(struct sviewer *sview, const char *path)
     new_node->lpath = NULL;
     new_node->buf.length = 0;
     new_node->buf.tlines = NULL;    /* This signals an empty buffer */
+    new_node->buf.breakpts = NULL;
+    new_node->buf.file_data = NULL;
+    new_node->buf.file_size = 0;
+    new_node->hl_lines = NULL;
+    new_node->hl_checkpoints = NULL;
+    new_node->hl_checkpoints_length = 0;
     new_node->sel_line = 0;
     new_node->sel_col = 0;
     new_node->sel_col_rbeg = 0;
     new_node->sel_col_rend = 0;
     new_node->sel_rline = 0;
+    new_node->sel_col_sbeg = -1;
+    new_node->sel_col_send = -1;
     new_node->exe_line = 0;
     new_node->last_modification = 0;    /* No timestamp yet */
+    new_node->last_used = 0;
 
     if (sview->list_head == NULL) {
         /* List is empty, this is the first node */
@@ -452,32 +924,111 @@ int source_add(struct sviewer *sview, const char *path)
         sview->list_head = new_node;
     }
 
+    /* The key is owned by the node, replace the key of an older node too */
+    std_hash_table_replace(sview->paths, new_node->path, new_node);
+
     return 0;
 }
 
+/* source_set_break:  Sets the breakpoint state of a line.
+ * -----------------
+ *
+ * When no file has the relative path yet, the state is kept until one
+ * does, see source_set_relative_path.
+ *
+ *   sview:  Source viewer object
+ *   path:   Relative path to the source file
+ *   line:   Line number of breakpoint
+ *   state:  0 for no breakpoint, 1 if enabled and 2 if disabled
+ *
+ * Return Value:  1 if a line of the displayed file changed, 0 otherwise.
+ */
+static int source_set_break(struct sviewer *sview, const char *path,
+        int line, char state)
+{
+    struct list_node *node;
+    struct pending_breaks *pending;
+
+    if (line <= 0)
+        return 0;
+
+    if ((node = get_relative_node(sview, path)) == NULL) {
+        pending = std_hash_table_lookup(sview->pending, path);
+
+        if (!pending) {
+            if (state == 0)
+                return 0;
+
+            pending = cgdb_malloc(sizeof (struct pending_breaks));
+            pending->breakpts = NULL;
+            pending->length = 0;
+            std_hash_table_insert(sview->pending, cgdb_strdup(path), pending);
+        }
+
+        if (line > pending->length) {
+            if (state == 0)
+                return 0;
+
+            pending->breakpts = cgdb_realloc(pending->breakpts, line);
+            memset(pending->breakpts + pending->length, 0,
+                    line - pending->length);
+            pending->length = line;
+        }
+
+        pending->breakpts[line - 1] = state;
+        return 0;
+    }
+
+    /* An unloaded file keeps its breakpoints, there is no need to load it */
+    if (node->buf.breakpts == NULL)
+        if (source_load(sview, node))
+            return 0;
+
+    if (line > node->buf.length || node->buf.breakpts[line - 1] == state)
+        return 0;
+
+    node->buf.breakpts[line - 1] = state;
+
+    return node == sview->cur;
+}
+
 int source_set_relative_path(struct sviewer *sview,
         const char *path, const char *lpath)
 {
+    struct list_node *node = get_node(sview, path);
+    struct pending_breaks *pending;
+    int i;
+
+    if (!node)
+        return -1;
 
-    struct list_node *node = sview->list_head;
+    if (node->lpath) {
+        if (get_relative_node(sview, node->lpath) == node)
+            std_hash_table_remove(sview->lpaths, node->lpath);
+        free(node->lpath);
+    }
 
-    while (node != NULL) {
-        if (strcmp(node->path, path) == 0) {
-            node->lpath = strdup(lpath);
-            return 0;
-        }
+    node->lpath = strdup(lpath);
+    std_hash_table_replace(sview->lpaths, node->lpath, node);
 
-        node = node->next;
+    /* Set the breakpoints that were waiting for this file */
+    pending = std_hash_table_lookup(sview->pending, lpath);
+    if (pending) {
+        if (node->buf.breakpts || source_load(sview, node) == 0)
+            for (i = 0; i < pending->length && i < node->buf.length; i++)
+                if (pending->breakpts[i])
+                    node->buf.breakpts[i] = pending->breakpts[i];
+
+        std_hash_table_remove(sview->pending, lpath);
     }
 
-    return -1;
+    return 0;
 }
 
 int source_del(struct sviewer *sview, const char *path)
 {
     struct list_node *cur;
     struct list_node *prev = NULL;
-    int i;
 
     /* Find the target node */
     for (cur = sview->list_head; cur != NULL; cur = cur->next) {
@@ -489,25 +1040,14 @@ int source_del(struct sviewer *sview, const char *path)
     if (cur == NULL)
         return 1;               /* Node not found */
 
-    /* Release file buffer, if one is in memory */
-    if (cur->buf.tlines) {
-        for (i = 0; i < cur->buf.length; i++) {
-            free(cur->buf.tlines[i]);
-            if (cur->buf.cur_line) {
-                free(cur->buf.cur_line);
-                cur->buf.cur_line = NULL;
-            }
-            free(cur->orig_buf.tlines[i]);
-        }
-    }
-    free(cur->buf.tlines);
-    free(cur->orig_buf.tlines);
+    /* Release file buffer, and the breakpoints of an unloaded file */
+    release_file_memory(cur);
 
-    /* Release the breakpoints */
-    if (cur->buf.breakpts) {
-        free(cur->buf.breakpts);
-        cur->buf.breakpts = NULL;
-    }
+    /* Remove the node from the indexes, unless a newer node took the key */
+    if (get_node(sview, cur->path) == cur)
+        std_hash_table_remove(sview->paths, cur->path);
+    if (cur->lpath && get_relative_node(sview, cur->lpath) == cur)
+        std_hash_table_remove(sview->lpaths, cur->lpath);
 
     /* Release file name */
     free(cur->path);
@@ -535,11 +1075,12 @@ int source_length(struct sviewer *sview, const char *path)
 {
     struct list_node *cur = get_node(sview, path);
 
-    if (!cur) {
-        /* Load the file if it's not already */
-        if (!cur->buf.tlines && load_file(cur))
-            return -1;
-    }
+    if (!cur)
+        return -1;
+
+    /* Load the file if it's not already */
+    if (source_load(sview, cur))
+        return -1;
 
     return cur->buf.length;
 }
@@ -555,24 +1096,24 @@ char *source_current_file(struct sviewer *sview, char *path)
 
 int source_display(struct sviewer *sview, int focus)
 {
-    char fmt[5];
     int width, height;
     int lwidth;
     int line;
     int i;
-    int attr = 0, sellineno;
-
-    if (hl_groups_get_attr(hl_groups_instance, HLG_SELECTED_LINE_NUMBER,
-                    &sellineno) == -1)
-        return -1;
+    struct source_row row;
 
     /* Check that a file is loaded */
     if (sview->cur == NULL || sview->cur->buf.tlines == NULL) {
         logo_display(sview->win);
-        wrefresh(sview->win);
+        wnoutrefresh(sview->win);
+
+        /* The logo covers the rows */
+        sview->frame->node = NULL;
         return 0;
     }
 
+    sview->cur->last_used = ++source_clock;
+
     /* Make sure cursor is visible */
     if (focus)
         curs_set(1);
@@ -593,158 +1134,51 @@ int source_display(struct sviewer *sview, int focus)
             line = 0;
     }
 
-    /* Print 'height' lines of the file, starting at 'line' */
-    lwidth = (int) log10(sview->cur->buf.length) + 1;
-    sprintf(fmt, "%%%dd", lwidth);
-
-    for (i = 0; i < height; i++, line++) {
-        wmove(sview->win, i, 0);
-        if (has_colors()) {
-            /* Outside of file, just finish drawing the vertical line */
-            if (line < 0 || line >= sview->cur->buf.length) {
-                int j;
-
-                for (j = 1; j < lwidth; j++)
-                    waddch(sview->win, ' ');
-                waddch(sview->win, '~');
-                if (focus)
-                    wattron(sview->win, A_BOLD);
-                waddch(sview->win, VERT_LINE);
-                if (focus)
-                    wattroff(sview->win, A_BOLD);
-                for (j = 2 + lwidth; j < width; j++)
-                    waddch(sview->win, ' ');
-
-                /* Mark the current line with an arrow */
-            } else if (line == sview->cur->exe_line) {
-                switch (sview->cur->buf.breakpts[line]) {
-                    case 0:
-                        if (hl_groups_get_attr(hl_groups_instance, HLG_ARROW,
-                                        &attr) == -1)
-                            return -1;
-                        break;
-                    case 1:
-                        if (hl_groups_get_attr(hl_groups_instance,
-                                        HLG_ENABLED_BREAKPOINT, &attr) == -1)
-                            return -1;
-                        break;
-                    case 2:
-                        if (hl_groups_get_attr(hl_groups_instance,
-                                        HLG_DISABLED_BREAKPOINT, &attr) == -1)
-                            return -1;
-                        break;
-                }
-                wattron(sview->win, attr);
-                wprintw(sview->win, fmt, line + 1);
-                wattroff(sview->win, attr);
-
-                draw_current_line(sview, line, lwidth);
-
-                /* Look for breakpoints */
-            } else if (sview->cur->buf.breakpts[line]) {
-                if (sview->cur->buf.breakpts[line] == 1) {
-                    if (hl_groups_get_attr(hl_groups_instance,
-                                    HLG_ENABLED_BREAKPOINT, &attr) == -1)
-                        return -1;
-                } else {
-                    if (hl_groups_get_attr(hl_groups_instance,
-                                    HLG_DISABLED_BREAKPOINT, &attr) == -1)
-                        return -1;
-                }
-                wattron(sview->win, attr);
-                wprintw(sview->win, fmt, line + 1);
-                wattroff(sview->win, attr);
-                if (focus)
-                    wattron(sview->win, A_BOLD);
-                waddch(sview->win, VERT_LINE);
-                if (focus)
-                    wattroff(sview->win, A_BOLD);
-                waddch(sview->win, ' ');
-
-                /* I know this is rediculous, it needs to be reimplemented */
-                if (sources_syntax_on) {
-                    if (line == sview->cur->sel_line &&
-                            sview->cur->buf.cur_line != NULL) {
-                        hl_wprintw(sview->win, sview->cur->buf.cur_line,
-                                width - lwidth - 2, sview->cur->sel_col);
-
-                    } else {
-                        hl_wprintw(sview->win, sview->cur->buf.tlines[line],
-                                width - lwidth - 2, sview->cur->sel_col);
-                    }
-                } else {
-                    if (line == sview->cur->sel_line &&
-                            sview->cur->buf.cur_line != NULL) {
-                        hl_wprintw(sview->win, sview->cur->orig_buf.cur_line,
-                                width - lwidth - 2, sview->cur->sel_col);
-
-                    } else {
-                        hl_wprintw(sview->win,
-                                sview->cur->orig_buf.tlines[line],
-                                width - lwidth - 2, sview->cur->sel_col);
-                    }
-                }
-            }
-            /* Ordinary lines */
-            else {
-                if (focus && sview->cur->sel_line == line)
-                    wattron(sview->win, sellineno);
+    /* Only the visible lines need to be highlighted */
+    if (has_colors() && sources_syntax_on)
+        highlight_lines(sview->cur, line, line + height);
 
-                wprintw(sview->win, fmt, line + 1);
+    lwidth = (int) log10(sview->cur->buf.length) + 1;
 
-                if (focus && sview->cur->sel_line == line)
-                    wattroff(sview->win, sellineno);
+    /* Find the rows that show something different than last time */
+    source_frame_update(sview, line, height, width, lwidth, focus);
 
-                if (focus)
-                    wattron(sview->win, A_BOLD);
-                waddch(sview->win, VERT_LINE);
-                if (focus)
-                    wattroff(sview->win, A_BOLD);
-                waddch(sview->win, ' ');
+    /* Draw only those rows of the 'height' lines starting at 'line' */
+    for (i = 0; i < height; i++, line++) {
+        source_row_get(sview, line, focus, &row);
+        if (source_row_equal(&row, &sview->frame->rows[i]))
+            continue;
 
-                /* I know this is rediculous, it needs to be reimplemented */
-                if (sources_syntax_on) {
-                    /* No special line information */
-                    if (line == sview->cur->sel_line &&
-                            sview->cur->buf.cur_line != NULL) {
-                        hl_wprintw(sview->win, sview->cur->buf.cur_line,
-                                width - lwidth - 2, sview->cur->sel_col);
-
-                    } else {
-                        hl_wprintw(sview->win, sview->cur->buf.tlines[line],
-                                width - lwidth - 2, sview->cur->sel_col);
-                    }
-                } else {
-                    /* No special line information */
-                    if (line == sview->cur->sel_line &&
-                            sview->cur->buf.cur_line != NULL) {
-                        hl_wprintw(sview->win, sview->cur->orig_buf.cur_line,
-                                width - lwidth - 2, sview->cur->sel_col);
-
-                    } else {
-                        hl_wprintw(sview->win,
-                                sview->cur->orig_buf.tlines[line],
-                                width - lwidth - 2, sview->cur->sel_col);
-                    }
-                }
-            }
-        } else {
-            wprintw(sview->win, "%s\n", sview->cur->buf.tlines[line]);
-        }
+        if (source_draw_row(sview, i, line, width, lwidth, focus) == -1)
+            return -1;
+        sview->frame->rows[i] = row;
     }
 
     wmove(sview->win, height - (line - sview->cur->sel_line), lwidth + 2);
-    wrefresh(sview->win);
+    wnoutrefresh(sview->win);
 
     return 0;
 }
 
+void source_damage(struct sviewer *sview)
+{
+    /* Forget what the rows show, so they are all drawn again */
+    memset(sview->frame->rows, 0,
+            sizeof (struct source_row) * sview->frame->height);
+    touchwin(sview->win);
+}
+
 void source_move(struct sviewer *sview,
         int pos_r, int pos_c, int height, int width)
 {
     delwin(sview->win);
     sview->win = newwin(height, width, pos_r, pos_c);
+    idlok(sview->win, TRUE);
     wclear(sview->win);
+
+    /* The new window shows nothing yet */
+    memset(sview->frame->rows, 0,
+            sizeof (struct source_row) * sview->frame->height);
 }
 
 void source_vscroll(struct sviewer *sview, int offset)
@@ -807,7 +1241,7 @@ int source_set_exec_line(struct sviewer *sview, const char *path, int line)
         return 3;
 
     /* Buffer the file if it's not already */
-    if (!sview->cur->buf.tlines && load_file(sview->cur))
+    if (source_load(sview, sview->cur))
         return 4;
 
     /* Update line, if set */
@@ -829,6 +1263,12 @@ void source_free(struct sviewer *sview)
     while (sview->list_head != NULL)
         source_del(sview, sview->list_head->path);
 
+    std_hash_table_destroy(sview->paths);
+    std_hash_table_destroy(sview->lpaths);
+    std_hash_table_destroy(sview->pending);
+    free(sview->frame->rows);
+    free(sview->frame);
+
     delwin(sview->win);
 }
 
@@ -855,64 +1295,38 @@ int source_search_regex(struct sviewer *sview,
             strlen(regex) == 0) {
 
         if (sview && sview->cur)
-            sview->cur->buf.cur_line = NULL;
+            sview->cur->sel_col_sbeg = sview->cur->sel_col_send = -1;
         return -1;
     }
 
     return hl_regex(regex,
             (const char **) sview->cur->buf.tlines,
-            (const char **) sview->cur->orig_buf.tlines,
-            sview->cur->orig_buf.length,
-            &sview->cur->buf.cur_line, &sview->cur->sel_line,
+            sview->cur->buf.length,
+            &sview->cur->sel_col_sbeg, &sview->cur->sel_col_send,
+            &sview->cur->sel_line,
             &sview->cur->sel_rline, &sview->cur->sel_col_rbeg,
             &sview->cur->sel_col_rend, opt, direction, icase);
 }
 
-void source_disable_break(struct sviewer *sview, const char *path, int line)
+int source_disable_break(struct sviewer *sview, const char *path, int line)
 {
-    struct list_node *node;
-
-    if ((node = get_relative_node(sview, path)) == NULL)
-        return;
-
-    if (node->buf.tlines == NULL)
-        if (load_file(node))
-            return;
-
-    if (line > 0 && line <= node->buf.length)
-        node->buf.breakpts[line - 1] = 2;
+    return source_set_break(sview, path, line, 2);
 }
 
-void source_enable_break(struct sviewer *sview, const char *path, int line)
+int source_enable_break(struct sviewer *sview, const char *path, int line)
 {
-    struct list_node *node;
-
-    if ((node = get_relative_node(sview, path)) == NULL)
-        return;
-
-    if (node->buf.tlines == NULL)
-        if (load_file(node))
-            return;
-
-    if (line > 0 && line <= node->buf.length) {
-        node->buf.breakpts[line - 1] = 1;
-    }
+    return source_set_break(sview, path, line, 1);
 }
 
-void source_clear_breaks(struct sviewer *sview)
+int source_clear_break(struct sviewer *sview, const char *path, int line)
 {
-    struct list_node *node;
-
-    for (node = sview->list_head; node != NULL; node = node->next)
-        memset(node->buf.breakpts, 0, node->buf.length);
-
+    return source_set_break(sview, path, line, 0);
 }
 
 int source_reload(struct sviewer *sview, const char *path, int force)
 {
     time_t timestamp;
     struct list_node *cur;
-    struct list_node *prev = NULL;
     int auto_source_reload =
             cgdbrc_get(CGDBRC_AUTOSOURCERELOAD)->variant.int_val;
 
@@ -923,21 +1337,17 @@ int source_reload(struct sviewer *sview, const char *path, int force)
         return -1;
 
     /* Find the target node */
-    for (cur = sview->list_head; cur != NULL; cur = cur->next) {
-        if (strcmp(path, cur->path) == 0)
-            break;
-        prev = cur;
-    }
-
-    if (cur == NULL)
+    if ((cur = get_node(sview, path)) == NULL)
         return 1;               /* Node not found */
 
     if ((auto_source_reload || force) && cur->last_modification < timestamp) {
 
-        if (release_file_memory(sview->cur) == -1)
+        /* GDB only sends breakpoint changes, the marks of the file are
+         * kept and fit to its new length when it is loaded again. */
+        if (unload_file(cur) == -1)
             return -1;
 
-        if (load_file(cur))
+        if (source_load(sview, cur))
             return -1;
     }
 
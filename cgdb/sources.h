@@ -3,11 +3,11 @@
  * 
  * Source file management routines for the GUI.  Provides the ability to
  * add files to the list, load files, and display within a curses window.
- * Files are buffered in memory when they are displayed, and held in
- * memory for the duration of execution.  If memory consumption becomes a
- * problem, this can be optimized to unload files which have not been
- * displayed recently, or only load portions of large files at once. (May
- * affect syntax highlighting.)
+ * Files are buffered in memory when they are displayed.  When the loaded
+ * files take more memory than the sourcecachesize option allows, the ones
+ * that have not been displayed recently are unloaded again.  Their
+ * breakpoints and selected lines are kept, so they are simply reloaded
+ * the next time they are needed.
  *
  */
 
@@ -46,27 +46,36 @@
 /* Data Structures */
 /* --------------- */
 
+struct std_hashtable;
+struct source_frame;
+
 /* Source viewer object */
 struct sviewer {
     struct list_node *list_head;    /* File list */
     struct list_node *cur;      /* Current node we're displaying */
     WINDOW *win;                /* Curses window */
+    struct std_hashtable *paths;    /* The nodes of the list, by path */
+    struct std_hashtable *lpaths;   /* The nodes of the list, by lpath */
+    struct std_hashtable *pending;  /* Breakpoints of unknown lpaths */
+    struct source_frame *frame; /* What the window shows, so that only the
+                                 * rows that change are drawn again */
 };
 
 struct buffer {
     int length;                 /* Number of lines in buffer */
     char **tlines;              /* Array containing file ( lines of text ) */
-    char *cur_line;             /* cur line may have unique color */
-    char *breakpts;             /* Breakpoints */
+    char *breakpts;             /* Breakpoints, kept while unloaded */
     int max_width;              /* Width of longest line in file */
+    char *file_data;            /* File contents tlines points into */
+    size_t file_size;           /* Size of the file contents in bytes */
 };
 
+struct hl_line;
 struct list_node;
 struct list_node {
     char *path;                 /* Full path to source file */
     char *lpath;                /* Relative path to source file */
     struct buffer buf;          /* File buffer */
-    struct buffer orig_buf;     /* Original File buffer ( no color ) */
     int sel_line;               /* Current line selected in viewer */
     int sel_col;                /* Current column selected in viewer */
     int exe_line;               /* Current line executing */
@@ -74,10 +83,18 @@ struct list_node {
     int sel_col_rbeg;           /* Current beg column matched in regex */
     int sel_col_rend;           /* Current end column matched in regex */
     int sel_rline;              /* Current line used by regex */
+    int sel_col_sbeg;           /* Beg column of the match shown while
+                                 * searching on sel_line, or -1 */
+    int sel_col_send;           /* End column of that match, or -1 */
 
     enum tokenizer_language_support language;   /* The language type of this file */
+    struct hl_line *hl_lines;   /* Highlighting of each line, or NULL */
+    int *hl_checkpoints;        /* Lexer state every HL_CHECKPOINT_INTERVAL lines */
+    int hl_checkpoints_length;  /* Number of lexer states in hl_checkpoints */
 
     time_t last_modification;   /* timestamp of last modification */
+    unsigned long last_used;    /* When the file was last used, for unloading
+                                 * the least recently used files */
 
     struct list_node *next;     /* Pointer to next link in list */
 };
@@ -156,6 +173,9 @@ char *source_current_file(struct sviewer *sview, char *path);
 /* source_display:  Display a portion of a file in a curses window.
  * ---------------
  *
+ * The window is copied to the virtual screen, the terminal is changed at
+ * the next doupdate.
+ *
  *   sview:  Source viewer object
  *   focus:  If the window should have focus
  *
@@ -163,6 +183,16 @@ char *source_current_file(struct sviewer *sview, char *path);
  */
 int source_display(struct sviewer *sview, int focus);
 
+/* source_damage:  Draw every row of the source window on the next display.
+ * --------------
+ *
+ * This is needed when the contents of the window were covered or when
+ * something that source_display can not notice changed, like the colors.
+ *
+ *   sview:  Source viewer object
+ */
+void source_damage(struct sviewer *sview);
+
 /* source_move:  Relocate the source window.
  * ------------
  *
@@ -259,26 +289,34 @@ void source_free(struct sviewer *sview);
  * ---------------------
  *
  *   sview:  The source viewer object
- *   path:   Full path to the source file
+ *   path:   Relative path to the source file
  *   line:   Line number of breakpoint
+ *
+ * Return Value:  1 if a line of the displayed file changed, 0 otherwise.
  */
-void source_disable_break(struct sviewer *sview, const char *path, int line);
+int source_disable_break(struct sviewer *sview, const char *path, int line);
 
 /* source_enable_break:  Enable a given breakpoint.
  * --------------------
  *
  *   sview:  The source viewer object
- *   path:   Full path to the source file
+ *   path:   Relative path to the source file
  *   line:   Line number of breakpoint
+ *
+ * Return Value:  1 if a line of the displayed file changed, 0 otherwise.
  */
-void source_enable_break(struct sviewer *sview, const char *path, int line);
+int source_enable_break(struct sviewer *sview, const char *path, int line);
 
-/* source_clear_breaks:  Clear all breakpoints from all files.
- * --------------------
+/* source_clear_break:  Remove a given breakpoint.
+ * -------------------
  *
  *   sview:  The source viewer object
+ *   path:   Relative path to the source file
+ *   line:   Line number of breakpoint
+ *
+ * Return Value:  1 if a line of the displayed file changed, 0 otherwise.
  */
-void source_clear_breaks(struct sviewer *sview);
+int source_clear_break(struct sviewer *sview, const char *path, int line);
 
 /**
  * Check's to see if the current source file has changed. If it has it loads
@@ -23,5 +23,10 @@ void usage(void)
             "   -h          Print help (this message) and then exit.\n"
 #endif
             "   -d          Set debugger to use.\n"
+#ifdef HAVE_GETOPT_H
+            "   --mi        Talk to the debugger with GDB/MI.\n"
+#else
+            "   -m          Talk to the debugger with GDB/MI.\n"
+#endif
             "   --          Marks the end of CGDB's options.\n");
 }
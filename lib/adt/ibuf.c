@@ -9,21 +9,23 @@
 #include <ctype.h>
 #endif /* HAVE_CTYPE_H */
 
+/* The size of a new buffer, it doubles each time it fills up */
+#define IBUF_INITIAL_SIZE 64
+
 struct ibuf {
     char *buf;
     unsigned long cur_buf_pos;
-    unsigned long cur_block_size;
-    unsigned long BLOCK_SIZE;
+    /* The number of bytes allocated for buf, including the null */
+    unsigned long capacity;
 };
 
 struct ibuf *ibuf_init(void)
 {
     struct ibuf *s = (struct ibuf *) cgdb_malloc(sizeof (struct ibuf));
 
-    s->BLOCK_SIZE = 4096;
-    s->cur_block_size = 1;
+    s->capacity = IBUF_INITIAL_SIZE;
     s->cur_buf_pos = 0;
-    s->buf = (char *) cgdb_malloc(sizeof (char) * (s->BLOCK_SIZE));
+    s->buf = (char *) cgdb_malloc(sizeof (char) * (s->capacity));
     s->buf[s->cur_buf_pos] = '\0';
 
     return s;
@@ -44,25 +46,37 @@ void ibuf_clear(struct ibuf *s)
     if (!s)
         return;
 
-    s->cur_block_size = 1;
     s->cur_buf_pos = 0;
     s->buf[s->cur_buf_pos] = '\0';
 }
 
-void ibuf_addchar(struct ibuf *s, char c)
+void ibuf_reserve(struct ibuf *s, size_t n)
 {
+    unsigned long needed, capacity;
+
     if (!s)
         return;
 
     /* the '+1' is for the null-terminated char */
-    if (s->cur_buf_pos + 1 == ((s->cur_block_size) * s->BLOCK_SIZE)) {
-        /* NOTE: s->cur_block_size *= 2 would double the buffer size 
-         *  however, I didn't think it was necesary since it should rarly go
-         *  above 1 block.
-         */
-        s->cur_block_size += 1;
-        s->buf = (char *) realloc(s->buf, s->cur_block_size * s->BLOCK_SIZE);
-    }
+    needed = s->cur_buf_pos + n + 1;
+    if (needed <= s->capacity)
+        return;
+
+    capacity = s->capacity;
+    while (capacity < needed)
+        capacity *= 2;
+
+    s->buf = (char *) cgdb_realloc(s->buf, capacity);
+    s->capacity = capacity;
+}
+
+void ibuf_addchar(struct ibuf *s, char c)
+{
+    if (!s)
+        return;
+
+    if (s->cur_buf_pos + 1 == s->capacity)
+        ibuf_reserve(s, 1);
 
     /* Add the new char and null terminate */
     s->buf[(s->cur_buf_pos)++] = c;
@@ -71,10 +85,19 @@ void ibuf_addchar(struct ibuf *s, char c)
 
 void ibuf_add(struct ibuf *s, const char *d)
 {
-    int length = strlen(d), i;
+    ibuf_addn(s, d, strlen(d));
+}
 
-    for (i = 0; i < length; i++)
-        ibuf_addchar(s, d[i]);
+void ibuf_addn(struct ibuf *s, const char *d, size_t n)
+{
+    if (!s)
+        return;
+
+    ibuf_reserve(s, n);
+
+    memcpy(s->buf + s->cur_buf_pos, d, n);
+    s->cur_buf_pos += n;
+    s->buf[(s->cur_buf_pos)] = '\0';
 }
 
 void ibuf_delchar(struct ibuf *s)
@@ -103,11 +126,28 @@ unsigned long ibuf_length(struct ibuf *s)
     return s->cur_buf_pos;
 }
 
+char *ibuf_steal(struct ibuf *s)
+{
+    char *buf;
+
+    if (!s)
+        return NULL;
+
+    buf = s->buf;
+
+    s->capacity = IBUF_INITIAL_SIZE;
+    s->cur_buf_pos = 0;
+    s->buf = (char *) cgdb_malloc(sizeof (char) * (s->capacity));
+    s->buf[s->cur_buf_pos] = '\0';
+
+    return buf;
+}
+
 struct ibuf *ibuf_dup(struct ibuf *s)
 {
     struct ibuf *ns = ibuf_init();
 
-    ibuf_add(ns, ibuf_get(s));
+    ibuf_addn(ns, ibuf_get(s), ibuf_length(s));
     return ns;
 }
 
@@ -9,7 +9,9 @@
 #include <stdlib.h>
 #endif /* HAVE_STDLIB_H */
 
-/* A simple interface to an infinate string */
+/* A simple interface to an infinate string.
+ * The buffer doubles in size when it fills up, so adding n chars one at
+ * a time, or all at once, takes O(n) time. */
 struct ibuf;
 
 /* ibuf_init: Returns a new infinate string.  */
@@ -27,12 +29,26 @@ void ibuf_clear(struct ibuf *s);
  */
 void ibuf_addchar(struct ibuf *s, char c);
 
-/* ibuf_add: Adds a char to the infinate buffer
+/* ibuf_add: Adds a string to the infinate buffer
  *  s - the infinate string to modify
  *  d - the string to add
  */
 void ibuf_add(struct ibuf *s, const char *d);
 
+/* ibuf_addn: Adds n chars to the infinate buffer
+ *  s - the infinate string to modify
+ *  d - the chars to add, they do not have to be null terminated
+ *  n - the number of chars in d
+ */
+void ibuf_addn(struct ibuf *s, const char *d, size_t n);
+
+/* ibuf_reserve: Makes room for n more chars, so they can be added without
+ *               the buffer growing again
+ *  s - the infinate string to modify
+ *  n - the number of chars that will be added
+ */
+void ibuf_reserve(struct ibuf *s, size_t n);
+
 /* ibuf_delchar: Delete the last char put in */
 void ibuf_delchar(struct ibuf *s);
 
@@ -46,6 +62,12 @@ char *ibuf_get(struct ibuf *s);
 /* ibuf_length: Returns the length of string s */
 unsigned long ibuf_length(struct ibuf *s);
 
+/* ibuf_steal: Takes the string out of s without copying it
+ *  return  - the null terminated string, the caller must free it
+ *  NOTE: s is left empty, and can still be used
+ */
+char *ibuf_steal(struct ibuf *s);
+
 /*
  * This will return a valid string that is equal to s.
  *
@@ -44,6 +44,8 @@ static int test_addchar(ibuf s);
 static int test_delchar(ibuf s);
 static int test_dup(ibuf s);
 static int test_trim(ibuf s);
+static int test_addn(ibuf s);
+static int test_steal(ibuf s);
 
 /* main:
  *
@@ -69,6 +71,8 @@ int main(int argc, char *argv[])
     result |= test_delchar(s);
     result |= test_dup(s);
     result |= test_trim(s);
+    result |= test_addn(s);
+    result |= test_steal(s);
 
     debug("Destroying string...\n");
     ibuf_free(s);
@@ -230,3 +234,76 @@ static int test_trim(ibuf s)
     debug("test_trim: Succeeded.\n");
     return 0;
 }
+
+static int test_addn(ibuf s)
+{
+    char data[10000];
+    int i;
+
+    /* Add only part of a string, the rest should be ignored */
+    ibuf_clear(s);
+    ibuf_addn(s, "hello world", 5);
+    if (strcmp(ibuf_get(s), "hello") != 0) {
+        debug("test_addn: 1: expected \"hello\", got: %s\n", ibuf_get(s));
+        return 1;
+    }
+
+    /* Adding nothing leaves the string alone */
+    ibuf_addn(s, "", 0);
+    if (strcmp(ibuf_get(s), "hello") != 0) {
+        debug("test_addn: 2: expected \"hello\", got: %s\n", ibuf_get(s));
+        return 2;
+    }
+
+    /* Add a run larger than the buffer, so it has to grow several times */
+    for (i = 0; i < sizeof (data); i++)
+        data[i] = 'a' + i % 26;
+
+    ibuf_clear(s);
+    ibuf_reserve(s, 10);
+    ibuf_addchar(s, 'x');
+    ibuf_addn(s, data, sizeof (data));
+    ibuf_addchar(s, 'y');
+
+    if (ibuf_length(s) != sizeof (data) + 2 ||
+            ibuf_get(s)[0] != 'x' ||
+            memcmp(ibuf_get(s) + 1, data, sizeof (data)) != 0 ||
+            strcmp(ibuf_get(s) + sizeof (data) + 1, "y") != 0) {
+        debug("test_addn: 3: long string mismatched\n");
+        return 3;
+    }
+
+    debug("test_addn: Succeeded.\n");
+    return 0;
+}
+
+static int test_steal(ibuf s)
+{
+    char *str;
+
+    ibuf_clear(s);
+    ibuf_add(s, "hello world");
+    str = ibuf_steal(s);
+
+    if (strcmp(str, "hello world") != 0) {
+        debug("test_steal: expected \"hello world\", got: %s\n", str);
+        free(str);
+        return 1;
+    }
+    free(str);
+
+    /* The ibuf is empty, and still usable */
+    if (ibuf_length(s) != 0 || strcmp(ibuf_get(s), "") != 0) {
+        debug("test_steal: expected empty string, got: %s\n", ibuf_get(s));
+        return 2;
+    }
+
+    ibuf_add(s, "again");
+    if (strcmp(ibuf_get(s), "again") != 0) {
+        debug("test_steal: expected \"again\", got: %s\n", ibuf_get(s));
+        return 3;
+    }
+
+    debug("test_steal: Succeeded.\n");
+    return 0;
+}
@@ -17,6 +17,8 @@
  * Boston, MA 02111-1307, USA.
  */
 
+#include <string.h>
+
 #include "std_hash.h"
 
 #define HASH_TABLE_MIN_SIZE 11
@@ -622,7 +624,7 @@ static void std_hash_table_resize(struct std_hashtable *hash_table)
     new_size = std_spaced_primes_closest(hash_table->nnodes);
     new_size = CLAMP(new_size, HASH_TABLE_MIN_SIZE, HASH_TABLE_MAX_SIZE);
 
-    new_nodes = malloc(sizeof (struct ghashnode *) * new_size);
+    new_nodes = calloc(new_size, sizeof (struct ghashnode *));
 
     for (i = 0; i < hash_table->size; i++)
         for (node = hash_table->nodes[i]; node; node = next) {
@@ -690,3 +692,21 @@ unsigned int std_direct_hash(const void *v)
 {
     return (size_t) v;
 }
+
+int std_str_equal(const void *v, const void *v2)
+{
+    return strcmp((const char *) v, (const char *) v2) == 0;
+}
+
+/* The X31 string hash, as used by glib */
+unsigned int std_str_hash(const void *v)
+{
+    const signed char *p = v;
+    unsigned int h = *p;
+
+    if (h)
+        for (p += 1; *p != '\0'; p++)
+            h = (h << 5) - h + *p;
+
+    return h;
+}
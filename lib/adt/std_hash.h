@@ -306,10 +306,13 @@ unsigned int std_hash_table_size(struct std_hashtable *hash_table);
 
 /* 
  * Some standard hash functions 
- * TODO: These are unimplemented. Please implement them when needed.
+ * TODO: The int functions are unimplemented. Please implement them when
+ * needed.
  */
 
+/* Compares two NUL terminated strings, returns 1 if they are equal */
 int std_str_equal(const void *v, const void *v2);
+/* Hashes a NUL terminated string */
 unsigned int std_str_hash(const void *v);
 int std_int_equal(const void *v, const void *v2);
 unsigned int std_int_hash(const void *v);
@@ -130,7 +130,7 @@ static void tgdb_list_delete(struct tgdb_list *list,
 
         node->next = NULL;
         node->prev = NULL;
-        node = NULL;
+        free(node);
 
         list->head = NULL;
         list->tail = NULL;
@@ -140,7 +140,7 @@ static void tgdb_list_delete(struct tgdb_list *list,
         /* Only the head is populated, free it */
         node->next = NULL;
         node->prev = NULL;
-        node = NULL;
+        free(node);
 
         list->head = NULL;
         list->tail = NULL;
@@ -152,7 +152,7 @@ static void tgdb_list_delete(struct tgdb_list *list,
 
         node->next = NULL;
         node->prev = NULL;
-        node = NULL;
+        free(node);
 
         /* If the list is size 2, remove the tail and set only the head */
         if (tgdb_list_size(list) == 2)
@@ -166,7 +166,7 @@ static void tgdb_list_delete(struct tgdb_list *list,
 
         node->next = NULL;
         node->prev = NULL;
-        node = NULL;
+        free(node);
 
         /* Delete from middle of list */
     } else {
@@ -175,7 +175,7 @@ static void tgdb_list_delete(struct tgdb_list *list,
 
         node->next = NULL;
         node->prev = NULL;
-        node = NULL;
+        free(node);
     }
 
     list->size--;
@@ -4,6 +4,25 @@
 
 #include "gdbmi_pt.h"
 #include "gdbmi_parser.h"
+#include "logger.h"
+
+/* The chunk sizes the file is pushed to the parser in */
+static const size_t chunk_sizes[] = { 1, 2, 3, 5, 7, 13, 64, 4096 };
+
+/* What the parser handed to the callback for each line */
+struct push_record {
+    char *line;
+    /* 1 if the line parsed */
+    int parsed;
+    int oob_records;
+    int result_record;
+};
+
+struct push_records {
+    struct push_record *records;
+    int length;
+    int capacity;
+};
 
 static void usage(char *progname)
 {
@@ -12,6 +31,203 @@ static void usage(char *progname)
     exit(-1);
 }
 
+/* push_callback:
+ * --------------
+ *
+ * Keeps what the parser handed over for a line.
+ */
+static void
+push_callback(void *context, const char *line, size_t size,
+        gdbmi_output_ptr output)
+{
+    struct push_records *records = (struct push_records *) context;
+    struct push_record *record;
+    gdbmi_oob_record_ptr oob;
+
+    if (records->length == records->capacity) {
+        records->capacity = records->capacity ? records->capacity * 2 : 64;
+        records->records = realloc(records->records,
+                sizeof (struct push_record) * records->capacity);
+    }
+
+    record = &records->records[records->length++];
+    record->line = malloc(size + 1);
+    memcpy(record->line, line, size);
+    record->line[size] = '\0';
+    record->parsed = output != NULL;
+    record->oob_records = 0;
+    record->result_record = 0;
+
+    if (output) {
+        for (oob = output->oob_record; oob; oob = oob->next)
+            ++record->oob_records;
+        record->result_record = output->result_record != NULL;
+    }
+
+    destroy_gdbmi_output(output);
+}
+
+static void free_push_records(struct push_records *records)
+{
+    int i;
+
+    for (i = 0; i < records->length; ++i)
+        free(records->records[i].line);
+
+    free(records->records);
+    records->records = NULL;
+    records->length = 0;
+    records->capacity = 0;
+}
+
+/* push_data:
+ * ----------
+ *
+ * Pushes data to a new parser, split at each of the offsets in splits.
+ * Returns -1 on error.
+ */
+static int
+push_data(const char *data, size_t size, const size_t * splits, int nsplits,
+        struct push_records *records)
+{
+    gdbmi_parser_ptr parser_ptr = gdbmi_parser_create();
+    size_t pos = 0, next;
+    int i, result = 0;
+
+    if (!parser_ptr)
+        return -1;
+
+    gdbmi_parser_set_callback(parser_ptr, push_callback, records);
+
+    for (i = 0; i <= nsplits && result == 0; ++i) {
+        next = i < nsplits ? splits[i] : size;
+        result = gdbmi_parser_push(parser_ptr, data + pos, next - pos);
+        pos = next;
+    }
+
+    gdbmi_parser_destroy(parser_ptr);
+
+    return result;
+}
+
+/* compare_push_records:
+ * ---------------------
+ *
+ * Checks that every line reached the callback exactly once, and parsed
+ * the same as when the data was pushed at once. Returns -1 if not.
+ */
+static int
+compare_push_records(struct push_records *expected,
+        struct push_records *records, const char *how)
+{
+    int i;
+
+    if (expected->length != records->length) {
+        printf("push %s: %d lines instead of %d\n", how, records->length,
+                expected->length);
+        return -1;
+    }
+
+    for (i = 0; i < records->length; ++i) {
+        struct push_record *a = &expected->records[i];
+        struct push_record *b = &records->records[i];
+
+        if (strcmp(a->line, b->line) != 0 || a->parsed != b->parsed ||
+                a->oob_records != b->oob_records ||
+                a->result_record != b->result_record) {
+            printf("push %s: line %d differs\n", how, i + 1);
+            return -1;
+        }
+    }
+
+    return 0;
+}
+
+/* test_push:
+ * ----------
+ *
+ * Pushes the file to the parser in chunks of several sizes, and split in
+ * two at every offset. That splits each line, and each c-string in it,
+ * at every character. Returns -1 if a split changed what was parsed.
+ */
+static int test_push(const char *path)
+{
+    struct push_records expected = { NULL, 0, 0 };
+    struct push_records records = { NULL, 0, 0 };
+    FILE *file;
+    char *data = NULL;
+    size_t size = 0, capacity = 0, nread, *splits, split;
+    char how[64];
+    int i, nsplits, result = 0;
+
+    file = fopen(path, "r");
+    if (!file) {
+        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+        return -1;
+    }
+
+    do {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            data = realloc(data, capacity);
+        }
+        nread = fread(data + size, 1, capacity - size, file);
+        size += nread;
+    } while (nread > 0);
+
+    fclose(file);
+
+    splits = malloc(sizeof (size_t) * (size + 1));
+
+    if (push_data(data, size, NULL, 0, &expected) == -1) {
+        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+        result = -1;
+    }
+
+    /* Each line of the file reaches the callback once */
+    for (split = 0, nsplits = 0; split < size; ++split)
+        if (data[split] == '\n')
+            ++nsplits;
+
+    if (result == 0 && nsplits != expected.length) {
+        printf("push: %d lines instead of %d\n", expected.length, nsplits);
+        result = -1;
+    }
+
+    for (i = 0; result == 0 &&
+            i < sizeof (chunk_sizes) / sizeof (chunk_sizes[0]); ++i) {
+        nsplits = 0;
+        for (split = chunk_sizes[i]; split < size; split += chunk_sizes[i])
+            splits[nsplits++] = split;
+
+        sprintf(how, "in chunks of %lu", (unsigned long) chunk_sizes[i]);
+        if (push_data(data, size, splits, nsplits, &records) == -1 ||
+                compare_push_records(&expected, &records, how) == -1)
+            result = -1;
+        free_push_records(&records);
+    }
+
+    for (split = 1; result == 0 && split < size; ++split) {
+        splits[0] = split;
+
+        sprintf(how, "split at %lu", (unsigned long) split);
+        if (push_data(data, size, splits, 1, &records) == -1 ||
+                compare_push_records(&expected, &records, how) == -1)
+            result = -1;
+        free_push_records(&records);
+    }
+
+    if (result == 0)
+        printf("push: %d lines parsed the same in every split\n",
+                expected.length);
+
+    free_push_records(&expected);
+    free(splits);
+    free(data);
+
+    return result;
+}
+
 int main(int argc, char **argv)
 {
     gdbmi_parser_ptr parser_ptr;
@@ -21,6 +237,10 @@ int main(int argc, char **argv)
     if (argc != 2)
         usage(argv[0]);
 
+    /* The parser reports its errors through the logger */
+    logger = logger_create();
+    logger_set_fd(logger, stderr);
+
     parser_ptr = gdbmi_parser_create();
 
     result = gdbmi_parser_parse_file(parser_ptr,
@@ -51,5 +271,11 @@ int main(int argc, char **argv)
 
     gdbmi_parser_destroy(parser_ptr);
 
+    /* The file must parse the same however it is split into chunks */
+    if (test_push(argv[1]) == -1)
+        return -1;
+
+    logger_destroy(logger);
+
     return 0;
 }
@@ -1,8 +1,22 @@
-%name-prefix="gdbmi_"
+%define api.prefix {gdbmi_}
 %define api.pure
-%define api.push_pull "push"
+%define api.push-pull push
 %defines
-%code requires { struct gdbmi_pdata; }
+%code requires {
+struct gdbmi_pdata;
+
+/* The lists being parsed keep their last node, so that each one is
+   appended in constant time.  */
+struct gdbmi_result_list {
+  struct gdbmi_result *head;
+  struct gdbmi_result *tail;
+};
+
+struct gdbmi_value_list {
+  struct gdbmi_value *head;
+  struct gdbmi_value *tail;
+};
+}
 %parse-param { struct gdbmi_pdata *gdbmi_pdata }
 
 %{
@@ -10,24 +24,11 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "gdbmi_pt.h"
-
-extern char *gdbmi_text;
-extern int gdbmi_lex (void);
-extern int gdbmi_lineno;
+#include "logger.h"
 
 void gdbmi_error (gdbmi_pdata_ptr gdbmi_pdata, const char *s)
 { 
-  fprintf (stderr, "%s:%d Error %s", __FILE__, __LINE__, s);
-  if (strcmp (gdbmi_text, "\n") == 0)
-    fprintf (stderr, "%s:%d at end of line %d\n", __FILE__, __LINE__, 
-	     gdbmi_lineno);
-  else 
-    {
-      fprintf (stderr, "%s:%d at token(%s), line (%d)\n", __FILE__, __LINE__, 
-	       gdbmi_text, gdbmi_lineno );
-      gdbmi_lex();
-      fprintf (stderr, "%s:%d before (%s)\n", __FILE__, __LINE__, gdbmi_text);
-    }
+  logger_write_pos (logger, __FILE__, __LINE__, "Error %s", s);
 }
 %}
 
@@ -44,9 +45,9 @@ void gdbmi_error (gdbmi_pdata_ptr gdbmi_pdata, const char *s)
 %token OPEN_BRACKET 	/* [ */
 %token CLOSED_BRACKET 	/* ] */
 %token NEWLINE		/* \n \r\n \r */
-%token INTEGER_LITERAL 	/* A number 1234 */
-%token STRING_LITERAL 	/* A string literal */
-%token CSTRING 		/* "a string like \" this " */
+%token <u_text> INTEGER_LITERAL 	/* A number 1234 */
+%token <u_text> STRING_LITERAL 	/* A string literal */
+%token <u_text> CSTRING 		/* "a string like \" this " */
 %token COMMA		/* , */
 %token CARROT		/* ^ */
 
@@ -62,21 +63,23 @@ void gdbmi_error (gdbmi_pdata_ptr gdbmi_pdata, const char *s)
   struct gdbmi_stream_record *u_stream_record;
   int u_async_class;
   char *u_variable;
+  struct gdbmi_result_list u_result_list;
+  struct gdbmi_value_list u_value_list;
   struct gdbmi_value *u_value;
   struct gdbmi_tuple *u_tuple;
   struct gdbmi_list *u_list;
   int u_stream_record_choice;
+  /* The text of a token, it lives in the scanner's buffer and is only
+     valid until the scanner reads the next token.  */
+  char *u_text;
 }
 
-%type <u_output> output_list
 %type <u_output> output
 %type <u_oob_record> oob_record
-%type <u_oob_record> opt_oob_record_list
-%type <u_result_record> opt_result_record
 %type <u_result_record> result_record
 %type <u_result_class> result_class
 %type <u_async_record_choice> async_record_class
-%type <u_result> result_list
+%type <u_result_list> result_list
 %type <u_result> result
 %type <u_token> opt_token
 %type <u_token> token
@@ -85,7 +88,7 @@ void gdbmi_error (gdbmi_pdata_ptr gdbmi_pdata, const char *s)
 %type <u_async_class> async_class
 %type <u_variable> variable
 %type <u_value> value
-%type <u_value> value_list
+%type <u_value_list> value_list
 %type <u_tuple> tuple
 %type <u_list> list
 %type <u_stream_record_choice> stream_record_class
@@ -93,81 +96,78 @@ void gdbmi_error (gdbmi_pdata_ptr gdbmi_pdata, const char *s)
 %start output_list
 %%
 
-output_list: output {
-  gdbmi_pdata->tree = $1;
+/* GDB sends one record per line. Each line is a gdbmi_output of its own,
+ * it is handed to the parser's client as soon as its newline is pushed. */
+output_list: {
 };
 
 output_list: output_list output {
-  gdbmi_pdata->tree = append_gdbmi_output (gdbmi_pdata->tree, $2);
+  $2->arena = gdbmi_pdata->arena;
+  gdbmi_pdata->arena = create_gdbmi_arena ();
+  gdbmi_pdata->tree = $2;
   gdbmi_pdata->parsed_one = 1;
 };
 
-output: opt_oob_record_list opt_result_record OPEN_PAREN variable CLOSED_PAREN NEWLINE { 
-  $$ = create_gdbmi_output ();
+output: oob_record NEWLINE {
+  $$ = create_gdbmi_output (gdbmi_pdata->arena);
   $$->oob_record = $1;
-  $$->result_record = $2;
-
-  if (strcmp ("gdb", $4) != 0)
-    gdbmi_error (gdbmi_pdata, "Syntax error, expected 'gdb'");
-
-  free ($4);
-} ;
-
-opt_oob_record_list: {
-  $$ = NULL;
 };
 
-opt_oob_record_list: opt_oob_record_list oob_record NEWLINE {
-  $$ = append_gdbmi_oob_record ($1, $2);
+output: result_record NEWLINE {
+  $$ = create_gdbmi_output (gdbmi_pdata->arena);
+  $$->result_record = $1;
 };
 
-opt_result_record: {
-  $$ = NULL;
-};
+/* The prompt ends the output of a command, it has no records.  */
+output: OPEN_PAREN variable CLOSED_PAREN NEWLINE {
+  if (strcmp ("gdb", $2) != 0)
+    {
+      gdbmi_error (gdbmi_pdata, "Syntax error, expected 'gdb'");
+      YYERROR;
+    }
 
-opt_result_record: result_record NEWLINE {
-  $$ = $1;
+  $$ = create_gdbmi_output (gdbmi_pdata->arena);
 };
 
 result_record: opt_token CARROT result_class {
-  $$ = create_gdbmi_result_record ();
+  $$ = create_gdbmi_result_record (gdbmi_pdata->arena);
   $$->token = $1;
   $$->result_class = $3;
   $$->result = NULL;
 };
 
 result_record: opt_token CARROT result_class COMMA result_list {
-  $$ = create_gdbmi_result_record ();
+  $$ = create_gdbmi_result_record (gdbmi_pdata->arena);
   $$->token = $1;
   $$->result_class = $3;
-  $$->result = $5;
+  $$->result = $5.head;
 };
 
 oob_record: async_record {
-  $$ = create_gdbmi_oob_record();
+  $$ = create_gdbmi_oob_record (gdbmi_pdata->arena);
   $$->record = GDBMI_ASYNC;
   $$->option.async_record = $1;
 };
 
 oob_record: stream_record {
-  $$ = create_gdbmi_oob_record();
+  $$ = create_gdbmi_oob_record (gdbmi_pdata->arena);
   $$->record = GDBMI_STREAM;
   $$->option.stream_record = $1;
 };
 
 async_record: opt_token async_record_class async_class {
-  $$ = create_gdbmi_async_record ();
+  $$ = create_gdbmi_async_record (gdbmi_pdata->arena);
   $$->token = $1;
   $$->async_record = $2;
   $$->async_class = $3;
 };
 
 async_record: opt_token async_record_class async_class COMMA result_list {
-  $$ = create_gdbmi_async_record ();
+  $$ = create_gdbmi_async_record (gdbmi_pdata->arena);
   $$->token = $1;
   $$->async_record = $2;
   $$->async_class = $3;
-  $$->result = $5;
+  $$->result = $5.head;
 };
 
 async_record_class: MULT_OP {
@@ -183,67 +183,75 @@ async_record_class: EQUAL_SIGN {
 };
 
 result_class: STRING_LITERAL {
-  if (strcmp ("done", gdbmi_text) == 0)
+  if (strcmp ("done", $1) == 0)
     $$ = GDBMI_DONE;
-  else if (strcmp ("running", gdbmi_text) == 0)
+  else if (strcmp ("running", $1) == 0)
     $$ = GDBMI_RUNNING;
-  else if (strcmp ("connected", gdbmi_text) == 0)
+  else if (strcmp ("connected", $1) == 0)
     $$ = GDBMI_CONNECTED;
-  else if (strcmp ("error", gdbmi_text) == 0)
+  else if (strcmp ("error", $1) == 0)
     $$ = GDBMI_ERROR;
-  else if (strcmp ("exit", gdbmi_text) == 0)
+  else if (strcmp ("exit", $1) == 0)
     $$ = GDBMI_EXIT;
   else
-    gdbmi_error (gdbmi_pdata, "Syntax error, expected 'done|running|connected|error|exit");
+    {
+      gdbmi_error (gdbmi_pdata, "Syntax error, expected 'done|running|connected|error|exit");
+      YYERROR;
+    }
 };
 
 async_class: STRING_LITERAL {
-  if (strcmp ("stopped", gdbmi_text) != 0)
-    gdbmi_error (gdbmi_pdata,  "Syntax error, expected 'stopped'" );
-
-  $$ = GDBMI_STOPPED;
+  if (strcmp ("stopped", $1) == 0)
+    $$ = GDBMI_STOPPED;
+  else
+    $$ = GDBMI_UNSUPPORTED;
 };
 
 result_list: result {
-  $$ = append_gdbmi_result (NULL, $1);	
+  $$.head = $$.tail = $1;
 };
 
 result_list: result_list COMMA result {
-  $$ = append_gdbmi_result ($1, $3);
+  $$ = $1;
+  $$.tail->next = $3;
+  $$.tail = $3;
 };
 
 result: variable EQUAL_SIGN value {
-  $$ = create_gdbmi_result ();
+  $$ = create_gdbmi_result (gdbmi_pdata->arena);
   $$->variable = $1;
+  $$->key = gdbmi_key_lookup ($1);
   $$->value = $3;
 };
 
 variable: STRING_LITERAL {
-  $$ = strdup (gdbmi_text);
+  $$ = gdbmi_arena_strdup (gdbmi_pdata->arena, $1);
 };
 
 value_list: value {
-  $$ = append_gdbmi_value (NULL, $1);	
+  $$.head = $$.tail = $1;
 };
 
 value_list: value_list COMMA value {
-  $$ = append_gdbmi_value ($1, $3); 
+  $$ = $1;
+  $$.tail->next = $3;
+  $$.tail = $3;
 };
 
 value: CSTRING {
-  $$ = create_gdbmi_value ();
+  $$ = create_gdbmi_value (gdbmi_pdata->arena);
   $$->value_choice = GDBMI_CSTRING;
-  $$->option.cstring = strdup (gdbmi_text); 
+  $$->option.cstring = gdbmi_arena_strdup (gdbmi_pdata->arena, $1); 
 };
 
 value: tuple {
-  $$ = create_gdbmi_value ();
+  $$ = create_gdbmi_value (gdbmi_pdata->arena);
   $$->value_choice = GDBMI_TUPLE;
   $$->option.tuple = $1;
 };
 
 value: list {
-  $$ = create_gdbmi_value ();
+  $$ = create_gdbmi_value (gdbmi_pdata->arena);
   $$->value_choice = GDBMI_LIST;
   $$->option.list = $1;
 };
@@ -253,8 +261,8 @@ tuple: OPEN_BRACE CLOSED_BRACE {
 };
 
 tuple: OPEN_BRACE result_list CLOSED_BRACE {
-  $$ = create_gdbmi_tuple ();
-  $$->result = $2;
+  $$ = create_gdbmi_tuple (gdbmi_pdata->arena);
+  $$->result = $2.head;
 };
 
 list: OPEN_BRACKET CLOSED_BRACKET {
@@ -262,21 +270,21 @@ list: OPEN_BRACKET CLOSED_BRACKET {
 };
 
 list: OPEN_BRACKET value_list CLOSED_BRACKET {
-  $$ = create_gdbmi_list ();
+  $$ = create_gdbmi_list (gdbmi_pdata->arena);
   $$->list_choice = GDBMI_VALUE;
-  $$->option.value = $2;
+  $$->option.value = $2.head;
 };
 
 list: OPEN_BRACKET result_list CLOSED_BRACKET {
-  $$ = create_gdbmi_list ();
+  $$ = create_gdbmi_list (gdbmi_pdata->arena);
   $$->list_choice = GDBMI_RESULT;
-  $$->option.result = $2;
+  $$->option.result = $2.head;
 };
 
 stream_record: stream_record_class CSTRING {
-  $$ = create_gdbmi_stream_record ();
+  $$ = create_gdbmi_stream_record (gdbmi_pdata->arena);
   $$->stream_record = $1;
-  $$->cstring = strdup ( gdbmi_text );
+  $$->cstring = gdbmi_arena_strdup (gdbmi_pdata->arena, $2);
 };
 
 stream_record_class: TILDA {
@@ -300,5 +308,5 @@ opt_token: token {
 };
 
 token: INTEGER_LITERAL {
-  $$ = atol (gdbmi_text);
+  $$ = atol ($1);
 };
@@ -2,6 +2,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "gdbmi_oc.h"
+#include "logger.h"
 
 #if 0
 static const char *const async_reason_string_lookup[] = {
@@ -172,7 +173,8 @@ int print_gdbmi_oc(gdbmi_oc_ptr param)
                         cur->input_commands.file_list_exec_source_files.
                         file_name_pair;
                 if (print_gdbmi_file_path_info(file_ptr) == -1) {
-                    fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "print_gdbmi_file_path_info failed");
                     return -1;
                 }
             }
@@ -184,7 +186,8 @@ int print_gdbmi_oc(gdbmi_oc_ptr param)
                 printf("break-list\n");
                 breakpoint_ptr = cur->input_commands.break_list.breakpoint_ptr;
                 if (print_gdbmi_breakpoint(breakpoint_ptr) == -1) {
-                    fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "print_gdbmi_breakpoint failed");
                     return -1;
                 }
             }
@@ -247,9 +250,47 @@ static int convert_cstring(const char *orig, char **new)
                 case '\\':
                     nstring[cur++] = '\\';
                     break;
+                case 'r':
+                    nstring[cur++] = '\r';
+                    break;
+                case 'a':
+                    nstring[cur++] = '\a';
+                    break;
+                case 'b':
+                    nstring[cur++] = '\b';
+                    break;
+                case 'f':
+                    nstring[cur++] = '\f';
+                    break;
+                case 'v':
+                    nstring[cur++] = '\v';
+                    break;
+                case 'e':
+                    nstring[cur++] = '\033';
+                    break;
+                case '0':
+                case '1':
+                case '2':
+                case '3':
+                case '4':
+                case '5':
+                case '6':
+                case '7':
+                {
+                    /* GDB escapes the other control characters in octal */
+                    int value = 0, digits;
+
+                    for (digits = 0; digits < 3 && i < length - 1 &&
+                            orig[i] >= '0' && orig[i] <= '7'; ++digits)
+                        value = value * 8 + (orig[i++] - '0');
+                    --i;
+                    nstring[cur++] = (char) value;
+                }
+                    break;
                 default:
-                    fprintf(stderr, "%s:%d char(%d)\n", __FILE__, __LINE__,
-                            orig[i]);
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "unknown escape char(%d)", orig[i]);
+                    free(nstring);
                     return -1;
             };
         } else
@@ -284,7 +325,7 @@ gdbmi_get_output_command(gdbmi_output_ptr output_ptr, gdbmi_oc_ptr * oc_ptr)
 
     *oc_ptr = create_gdbmi_oc();
     if (!(*oc_ptr)) {
-        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+        logger_write_pos(logger, __FILE__, __LINE__, "create_gdbmi_oc failed");
         return -1;
     }
 
@@ -303,7 +344,8 @@ gdbmi_get_output_command(gdbmi_output_ptr output_ptr, gdbmi_oc_ptr * oc_ptr)
                     gdbmi_oc_cstring_ll_ptr ncstring =
                             create_gdbmi_cstring_ll();
                     if (convert_cstring(orig, &(ncstring->cstring)) == -1) {
-                        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+                        logger_write_pos(logger, __FILE__, __LINE__,
+                                "convert_cstring failed");
                         return -1;
                     }
 
@@ -319,6 +361,230 @@ gdbmi_get_output_command(gdbmi_output_ptr output_ptr, gdbmi_oc_ptr * oc_ptr)
     return 0;
 }
 
+/* The schemas of the tuples the output commands are read from. A schema
+ * maps the key of a result to its slot plus one, 0 for the keys that are
+ * not part of it. */
+enum gdbmi_breakpoint_field {
+    GDBMI_BREAKPOINT_NUMBER,
+    GDBMI_BREAKPOINT_TYPE,
+    GDBMI_BREAKPOINT_DISP,
+    GDBMI_BREAKPOINT_ENABLED,
+    GDBMI_BREAKPOINT_ADDR,
+    GDBMI_BREAKPOINT_FUNC,
+    GDBMI_BREAKPOINT_FILE,
+    GDBMI_BREAKPOINT_FULLNAME,
+    GDBMI_BREAKPOINT_LINE,
+    GDBMI_BREAKPOINT_TIMES,
+    GDBMI_BREAKPOINT_LAST
+};
+
+static const unsigned char gdbmi_breakpoint_schema[GDBMI_KEY_LAST] = {
+    [GDBMI_KEY_NUMBER] = GDBMI_BREAKPOINT_NUMBER + 1,
+    [GDBMI_KEY_TYPE] = GDBMI_BREAKPOINT_TYPE + 1,
+    [GDBMI_KEY_DISP] = GDBMI_BREAKPOINT_DISP + 1,
+    [GDBMI_KEY_ENABLED] = GDBMI_BREAKPOINT_ENABLED + 1,
+    [GDBMI_KEY_ADDR] = GDBMI_BREAKPOINT_ADDR + 1,
+    [GDBMI_KEY_FUNC] = GDBMI_BREAKPOINT_FUNC + 1,
+    [GDBMI_KEY_FILE] = GDBMI_BREAKPOINT_FILE + 1,
+    [GDBMI_KEY_FULLNAME] = GDBMI_BREAKPOINT_FULLNAME + 1,
+    [GDBMI_KEY_LINE] = GDBMI_BREAKPOINT_LINE + 1,
+    [GDBMI_KEY_TIMES] = GDBMI_BREAKPOINT_TIMES + 1
+};
+
+static const unsigned char gdbmi_frame_schema[GDBMI_KEY_LAST] = {
+    [GDBMI_KEY_FUNC] = GDBMI_FRAME_FUNC + 1,
+    [GDBMI_KEY_FILE] = GDBMI_FRAME_FILE + 1,
+    [GDBMI_KEY_FULLNAME] = GDBMI_FRAME_FULLNAME + 1,
+    [GDBMI_KEY_LINE] = GDBMI_FRAME_LINE + 1
+};
+
+/* A file of -file-list-exec-source-file and -file-list-exec-source-files */
+enum gdbmi_file_field {
+    GDBMI_FILE_FILE,
+    GDBMI_FILE_FULLNAME,
+    GDBMI_FILE_LINE,
+    GDBMI_FILE_LAST
+};
+
+static const unsigned char gdbmi_file_schema[GDBMI_KEY_LAST] = {
+    [GDBMI_KEY_FILE] = GDBMI_FILE_FILE + 1,
+    [GDBMI_KEY_FULLNAME] = GDBMI_FILE_FULLNAME + 1,
+    [GDBMI_KEY_LINE] = GDBMI_FILE_LINE + 1
+};
+
+/* gdbmi_schema_lookup:
+ * --------------------
+ *
+ * Finds the fields of SCHEMA in the results RESULT in one pass. VALUES
+ * has a slot for each field, it is NULL for the fields not found. When
+ * a key is in the results more than once, the first one is kept.
+ */
+static void
+gdbmi_schema_lookup(const unsigned char *schema, int size,
+        gdbmi_result_ptr result, gdbmi_value_ptr * values)
+{
+    int slot;
+
+    memset(values, 0, sizeof (gdbmi_value_ptr) * size);
+
+    for (; result; result = result->next) {
+        slot = schema[result->key];
+        if (slot && !values[slot - 1])
+            values[slot - 1] = result->value;
+    }
+}
+
+int gdbmi_get_frame_fields(gdbmi_tuple_ptr tuple, gdbmi_value_ptr * values)
+{
+    if (!tuple || !values)
+        return -1;
+
+    gdbmi_schema_lookup(gdbmi_frame_schema, GDBMI_FRAME_LAST, tuple->result,
+            values);
+
+    return 0;
+}
+
+/* gdbmi_convert_cstring_value:
+ * ----------------------------
+ *
+ * Converts VALUE into NEW if it is a cstring, otherwise leaves NEW alone.
+ * Returns -1 on error.
+ */
+static int gdbmi_convert_cstring_value(gdbmi_value_ptr value, char **new)
+{
+    if (!value || value->value_choice != GDBMI_CSTRING)
+        return 0;
+
+    return convert_cstring(value->option.cstring, new);
+}
+
+/* gdbmi_convert_int_value:
+ * ------------------------
+ *
+ * Converts VALUE into NEW if it is a cstring, otherwise leaves NEW alone.
+ * Returns -1 on error.
+ */
+static int gdbmi_convert_int_value(gdbmi_value_ptr value, int *new)
+{
+    char *nstr = NULL;
+
+    if (gdbmi_convert_cstring_value(value, &nstr) == -1)
+        return -1;
+
+    if (nstr) {
+        *new = atoi(nstr);
+        free(nstr);
+    }
+
+    return 0;
+}
+
+/* gdbmi_cstring_value_is:
+ * -----------------------
+ *
+ * 1 if VALUE is the cstring CSTRING, quotes included, otherwise 0.
+ */
+static int gdbmi_cstring_value_is(gdbmi_value_ptr value, const char *cstring)
+{
+    return value && value->value_choice == GDBMI_CSTRING &&
+            strcmp(value->option.cstring, cstring) == 0;
+}
+
+/* gdbmi_get_file_path_info:
+ * -------------------------
+ *
+ * Reads an entry of the files list of -file-list-exec-source-files.
+ */
+static gdbmi_oc_file_path_info_ptr gdbmi_get_file_path_info(gdbmi_tuple_ptr
+        tuple)
+{
+    gdbmi_value_ptr values[GDBMI_FILE_LAST];
+    gdbmi_oc_file_path_info_ptr ptr = create_gdbmi_file_path_info();
+
+    if (!ptr) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "create_gdbmi_file_path_info failed");
+        return NULL;
+    }
+
+    gdbmi_schema_lookup(gdbmi_file_schema, GDBMI_FILE_LAST, tuple->result,
+            values);
+
+    if (gdbmi_convert_cstring_value(values[GDBMI_FILE_FILE],
+                    &ptr->file) == -1 ||
+            gdbmi_convert_cstring_value(values[GDBMI_FILE_FULLNAME],
+                    &ptr->fullname) == -1) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "file tuple conversion failed");
+        destroy_gdbmi_file_path_info(ptr);
+        return NULL;
+    }
+
+    return ptr;
+}
+
+/* gdbmi_get_breakpoint:
+ * ---------------------
+ *
+ * Reads a bkpt tuple of -break-list.
+ */
+static gdbmi_oc_breakpoint_ptr gdbmi_get_breakpoint(gdbmi_tuple_ptr tuple)
+{
+    gdbmi_value_ptr values[GDBMI_BREAKPOINT_LAST];
+    gdbmi_oc_breakpoint_ptr ptr = create_gdbmi_breakpoint();
+
+    if (!ptr) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "create_gdbmi_breakpoint failed");
+        return NULL;
+    }
+
+    gdbmi_schema_lookup(gdbmi_breakpoint_schema, GDBMI_BREAKPOINT_LAST,
+            tuple->result, values);
+
+    if (gdbmi_cstring_value_is(values[GDBMI_BREAKPOINT_TYPE],
+                    "\"breakpoint\""))
+        ptr->type = GDBMI_BREAKPOINT;
+    else if (gdbmi_cstring_value_is(values[GDBMI_BREAKPOINT_TYPE],
+                    "\"watchpoint\""))
+        ptr->type = GDBMI_WATCHPOINT;
+
+    if (gdbmi_cstring_value_is(values[GDBMI_BREAKPOINT_DISP], "\"keep\""))
+        ptr->disposition = GDBMI_KEEP;
+    else if (gdbmi_cstring_value_is(values[GDBMI_BREAKPOINT_DISP],
+                    "\"nokeep\""))
+        ptr->disposition = GDBMI_NOKEEP;
+
+    if (values[GDBMI_BREAKPOINT_ENABLED] &&
+            values[GDBMI_BREAKPOINT_ENABLED]->value_choice == GDBMI_CSTRING)
+        ptr->enabled =
+                gdbmi_cstring_value_is(values[GDBMI_BREAKPOINT_ENABLED],
+                "\"y\"");
+
+    if (gdbmi_convert_int_value(values[GDBMI_BREAKPOINT_NUMBER],
+                    &ptr->number) == -1 ||
+            gdbmi_convert_cstring_value(values[GDBMI_BREAKPOINT_ADDR],
+                    &ptr->address) == -1 ||
+            gdbmi_convert_cstring_value(values[GDBMI_BREAKPOINT_FUNC],
+                    &ptr->func) == -1 ||
+            gdbmi_convert_cstring_value(values[GDBMI_BREAKPOINT_FILE],
+                    &ptr->file) == -1 ||
+            gdbmi_convert_cstring_value(values[GDBMI_BREAKPOINT_FULLNAME],
+                    &ptr->fullname) == -1 ||
+            gdbmi_convert_int_value(values[GDBMI_BREAKPOINT_LINE],
+                    &ptr->line) == -1 ||
+            gdbmi_convert_int_value(values[GDBMI_BREAKPOINT_TIMES],
+                    &ptr->times) == -1) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "bkpt tuple conversion failed");
+        destroy_gdbmi_breakpoint(ptr);
+        return NULL;
+    }
+
+    return ptr;
+}
+
 static int
 gdbmi_get_specific_output_command(gdbmi_output_ptr output_ptr,
         gdbmi_oc_ptr oc_ptr, gdbmi_oc_cstring_ll_ptr mi_input_cmds)
@@ -328,7 +594,8 @@ gdbmi_get_specific_output_command(gdbmi_output_ptr output_ptr,
     enum gdbmi_input_command mi_input_cmd_kind;
 
     if (!mi_input_cmds) {
-        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "no MI input command for the result record");
         return -1;
     }
 
@@ -339,428 +606,101 @@ gdbmi_get_specific_output_command(gdbmi_output_ptr output_ptr,
     switch (mi_input_cmd_kind) {
         case GDBMI_FILE_LIST_EXEC_SOURCE_FILE:
         {
-            gdbmi_result_ptr result_ptr = output_ptr->result_record->result;
-
-            while (result_ptr) {
-                if (strcmp(result_ptr->variable, "line") == 0) {
-                    char *nline;
-
-                    if (convert_cstring(result_ptr->value->option.cstring,
-                                    &nline) == -1) {
-                        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
-                        return -1;
-                    }
-
-                    oc_ptr->input_commands.file_list_exec_source_file.line =
-                            atoi(nline);
-                    free(nline);
-                    nline = NULL;
-                } else if (strcmp(result_ptr->variable, "file") == 0) {
-                    char *nline;
-
-                    if (convert_cstring(result_ptr->value->option.cstring,
-                                    &nline) == -1) {
-                        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
-                        return -1;
-                    }
-
-                    oc_ptr->input_commands.file_list_exec_source_file.file =
-                            nline;
-                } else if (strcmp(result_ptr->variable, "fullname") == 0) {
-                    char *nline;
-
-                    if (convert_cstring(result_ptr->value->option.cstring,
-                                    &nline) == -1) {
-                        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
-                        return -1;
-                    }
-                    oc_ptr->input_commands.file_list_exec_source_file.fullname =
-                            nline;
-                }
-
-                result_ptr = result_ptr->next;
+            gdbmi_value_ptr values[GDBMI_FILE_LAST];
+
+            gdbmi_schema_lookup(gdbmi_file_schema, GDBMI_FILE_LAST,
+                    output_ptr->result_record->result, values);
+
+            if (gdbmi_convert_int_value(values[GDBMI_FILE_LINE],
+                            &oc_ptr->input_commands.
+                            file_list_exec_source_file.line) == -1 ||
+                    gdbmi_convert_cstring_value(values[GDBMI_FILE_FILE],
+                            &oc_ptr->input_commands.
+                            file_list_exec_source_file.file) == -1 ||
+                    gdbmi_convert_cstring_value(values[GDBMI_FILE_FULLNAME],
+                            &oc_ptr->input_commands.
+                            file_list_exec_source_file.fullname) == -1) {
+                logger_write_pos(logger, __FILE__, __LINE__,
+                        "-file-list-exec-source-file conversion failed");
+                return -1;
             }
         }
             break;
         case GDBMI_FILE_LIST_EXEC_SOURCE_FILES:
         {
-            gdbmi_result_ptr result_ptr = output_ptr->result_record->result;
+            gdbmi_oc_file_path_info_ptr *tail = &oc_ptr->input_commands.
+                    file_list_exec_source_files.file_name_pair;
+            gdbmi_result_ptr files = gdbmi_result_find(output_ptr->
+                    result_record->result, GDBMI_KEY_FILES);
+            gdbmi_list_ptr list;
+            gdbmi_value_ptr value_ptr;
+
+            if (!files || files->value->value_choice != GDBMI_LIST)
+                break;
 
-            while (result_ptr) {
-                if (strcmp(result_ptr->variable, "files") == 0) {
-                    if (result_ptr->value->value_choice == GDBMI_LIST) {
-                        gdbmi_list_ptr list = result_ptr->value->option.list;
-
-                        while (list) {
-                            if (list->list_choice == GDBMI_VALUE) {
-                                gdbmi_value_ptr value_ptr = list->option.value;
-
-                                while (value_ptr) {
-                                    if (value_ptr->value_choice == GDBMI_TUPLE) {
-                                        gdbmi_oc_file_path_info_ptr ptr =
-                                                create_gdbmi_file_path_info();
-                                        gdbmi_result_ptr result =
-                                                value_ptr->option.tuple->result;
-                                        while (result) {
-                                            if (strcmp(result->variable,
-                                                            "file") == 0) {
-                                                if (convert_cstring(result->
-                                                                value->option.
-                                                                cstring,
-                                                                &(ptr->file)) ==
-                                                        -1) {
-                                                    fprintf(stderr, "%s:%d\n",
-                                                            __FILE__, __LINE__);
-                                                    return -1;
-                                                }
-                                            } else if (strcmp(result->variable,
-                                                            "fullname") == 0) {
-                                                if (convert_cstring(result->
-                                                                value->option.
-                                                                cstring,
-                                                                &(ptr->fullname)) == -1) {
-                                                    fprintf(stderr, "%s:%d\n",
-                                                            __FILE__, __LINE__);
-                                                    return -1;
-                                                }
-                                            }
-                                            result = result->next;
-                                        }
-
-                                        oc_ptr->input_commands.
-                                                file_list_exec_source_files.
-                                                file_name_pair =
-                                                append_gdbmi_file_path_info
-                                                (oc_ptr->input_commands.
-                                                file_list_exec_source_files.
-                                                file_name_pair, ptr);
-                                    }
-                                    value_ptr = value_ptr->next;
-                                }
-                            }
-
-                            list = list->next;
-                        }
+            for (list = files->value->option.list; list; list = list->next) {
+                if (list->list_choice != GDBMI_VALUE)
+                    continue;
+
+                for (value_ptr = list->option.value; value_ptr;
+                        value_ptr = value_ptr->next) {
+                    if (value_ptr->value_choice != GDBMI_TUPLE)
+                        continue;
+
+                    *tail = gdbmi_get_file_path_info(value_ptr->option.tuple);
+                    if (!*tail) {
+                        logger_write_pos(logger, __FILE__, __LINE__,
+                                "gdbmi_get_file_path_info failed");
+                        return -1;
                     }
+                    tail = &(*tail)->next;
                 }
-
-                result_ptr = result_ptr->next;
             }
         }
             break;
         case GDBMI_BREAK_LIST:
         {
+            gdbmi_oc_breakpoint_ptr *tail =
+                    &oc_ptr->input_commands.break_list.breakpoint_ptr;
             gdbmi_result_ptr result_ptr = output_ptr->result_record->result;
+            gdbmi_list_ptr list_ptr;
 
-            if (strcmp(result_ptr->variable, "BreakpointTable") == 0) {
-                if (result_ptr->value->value_choice == GDBMI_TUPLE) {
-                    result_ptr = result_ptr->value->option.tuple->result;
-                    while (result_ptr) {
-                        if (strcmp(result_ptr->variable, "body") == 0) {
-                            if (result_ptr->value->value_choice == GDBMI_LIST) {
-                                gdbmi_list_ptr list_ptr =
-                                        result_ptr->value->option.list;
-                                if (list_ptr
-                                        && list_ptr->list_choice ==
-                                        GDBMI_RESULT) {
-                                    gdbmi_result_ptr result_ptr =
-                                            list_ptr->option.result;
-                                    while (result_ptr) {
-                                        if (strcmp(result_ptr->variable,
-                                                        "bkpt") == 0) {
-                                            gdbmi_oc_breakpoint_ptr ptr =
-                                                    create_gdbmi_breakpoint();
-
-                                            gdbmi_value_ptr value_ptr =
-                                                    result_ptr->value;
-                                            if (value_ptr->value_choice ==
-                                                    GDBMI_TUPLE) {
-                                                gdbmi_result_ptr result_ptr =
-                                                        value_ptr->option.
-                                                        tuple->result;
-                                                while (result_ptr) {
-                                                    if (strcmp(result_ptr->
-                                                                    variable,
-                                                                    "number") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            char *nstr;
-
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &nstr)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-
-                                                            ptr->number =
-                                                                    atoi(nstr);
-                                                            free(nstr);
-                                                            nstr = NULL;
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "type") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (strcmp
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            "\"breakpoint\"")
-                                                                    == 0)
-                                                                ptr->type =
-                                                                        GDBMI_BREAKPOINT;
-                                                            else if (strcmp
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            "\"watchpoint\"")
-                                                                    == 0)
-                                                                ptr->type =
-                                                                        GDBMI_WATCHPOINT;
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "disp") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (strcmp
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            "\"keep\"")
-                                                                    == 0)
-                                                                ptr->disposition
-                                                                        =
-                                                                        GDBMI_KEEP;
-                                                            else if (strcmp
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            "\"nokeep\"")
-                                                                    == 0)
-                                                                ptr->disposition
-                                                                        =
-                                                                        GDBMI_NOKEEP;
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "enabled")
-                                                            == 0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (strcmp
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            "\"y\"")
-                                                                    == 0)
-                                                                ptr->enabled =
-                                                                        1;
-                                                            else
-                                                                ptr->enabled =
-                                                                        0;
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "addr") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &ptr->
-                                                                            address)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "func") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &ptr->
-                                                                            func)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "file") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &ptr->
-                                                                            file)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "fullname")
-                                                            == 0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &ptr->
-                                                                            fullname)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "line") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            char *nstr;
-
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &nstr)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-
-                                                            ptr->line =
-                                                                    atoi(nstr);
-                                                            free(nstr);
-                                                            nstr = NULL;
-                                                        }
-                                                    } else if (strcmp
-                                                            (result_ptr->
-                                                                    variable,
-                                                                    "times") ==
-                                                            0) {
-                                                        if (result_ptr->value->
-                                                                value_choice ==
-                                                                GDBMI_CSTRING) {
-                                                            char *nstr;
-
-                                                            if (convert_cstring
-                                                                    (result_ptr->
-                                                                            value->
-                                                                            option.
-                                                                            cstring,
-                                                                            &nstr)
-                                                                    == -1) {
-                                                                fprintf(stderr,
-                                                                        "%s:%d\n",
-                                                                        __FILE__,
-                                                                        __LINE__);
-                                                                return -1;
-                                                            }
-
-                                                            ptr->times =
-                                                                    atoi(nstr);
-                                                            free(nstr);
-                                                            nstr = NULL;
-                                                        }
-                                                    }
-
-                                                    result_ptr =
-                                                            result_ptr->next;
-                                                }
-                                            }
-
-                                            oc_ptr->input_commands.break_list.
-                                                    breakpoint_ptr =
-                                                    append_gdbmi_breakpoint
-                                                    (oc_ptr->input_commands.
-                                                    break_list.breakpoint_ptr,
-                                                    ptr);
-                                        }
-                                        result_ptr = result_ptr->next;
-                                    }
-                                }
-                            }
-                        }
-                        result_ptr = result_ptr->next;
-                    }
+            if (!result_ptr || result_ptr->key != GDBMI_KEY_BREAKPOINT_TABLE ||
+                    result_ptr->value->value_choice != GDBMI_TUPLE)
+                break;
+
+            result_ptr = gdbmi_tuple_find(result_ptr->value->option.tuple,
+                    GDBMI_KEY_BODY);
+            if (!result_ptr || result_ptr->value->value_choice != GDBMI_LIST)
+                break;
+
+            list_ptr = result_ptr->value->option.list;
+            if (!list_ptr || list_ptr->list_choice != GDBMI_RESULT)
+                break;
+
+            for (result_ptr = list_ptr->option.result; result_ptr;
+                    result_ptr = result_ptr->next) {
+                if (result_ptr->key != GDBMI_KEY_BKPT)
+                    continue;
+
+                if (result_ptr->value->value_choice == GDBMI_TUPLE)
+                    *tail = gdbmi_get_breakpoint(result_ptr->value->option.
+                            tuple);
+                else
+                    *tail = create_gdbmi_breakpoint();
+
+                if (!*tail) {
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "gdbmi_get_breakpoint failed");
+                    return -1;
                 }
+                tail = &(*tail)->next;
             }
         }
             break;
         case GDBMI_LAST:
-            fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "unknown MI input command");
             return -1;
     };
 
@@ -791,7 +731,8 @@ gdbmi_get_output_commands(gdbmi_output_ptr output_ptr,
 
         result = gdbmi_get_output_command(cur, &cur_oc_ptr);
         if (result == -1) {
-            fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "gdbmi_get_output_command failed");
             return -1;
         }
         *oc_ptr = append_gdbmi_oc(*oc_ptr, cur_oc_ptr);
@@ -801,7 +742,8 @@ gdbmi_get_output_commands(gdbmi_output_ptr output_ptr,
             result = gdbmi_get_specific_output_command(cur, cur_oc_ptr,
                     cur_mi_input_cmds);
             if (result == -1) {
-                fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+                logger_write_pos(logger, __FILE__, __LINE__,
+                        "gdbmi_get_specific_output_command failed");
                 return -1;
             }
 
@@ -812,7 +754,8 @@ gdbmi_get_output_commands(gdbmi_output_ptr output_ptr,
     }
 
     if (cur_mi_input_cmds != NULL) {
-        fprintf(stderr, "%s:%d\n", __FILE__, __LINE__);
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "more MI input commands than result records");
         return -1;
     }
 
@@ -125,6 +125,31 @@ int
 gdbmi_get_output_commands(gdbmi_output_ptr output_ptr,
         gdbmi_oc_cstring_ll_ptr mi_input_cmds, gdbmi_oc_ptr * oc_ptr);
 
+/* The fields of a frame tuple */
+enum gdbmi_frame_field {
+    GDBMI_FRAME_FUNC,
+    GDBMI_FRAME_FILE,
+    GDBMI_FRAME_FULLNAME,
+    GDBMI_FRAME_LINE,
+
+    GDBMI_FRAME_LAST
+};
+
+/**
+ * Finds the fields of a frame tuple, in one pass over its results.
+ *
+ * \param tuple
+ * The frame tuple
+ *
+ * \param values
+ * An array of GDBMI_FRAME_LAST values, indexed by enum gdbmi_frame_field.
+ * On return, the value of each field, or NULL if the tuple does not have it.
+ *
+ * \return
+ * 0 on success, -1 on error.
+ */
+int gdbmi_get_frame_fields(gdbmi_tuple_ptr tuple, gdbmi_value_ptr * values);
+
 /* Creating, Destroying and printing MI output commands  */
 gdbmi_oc_ptr create_gdbmi_oc(void);
 int destroy_gdbmi_oc(gdbmi_oc_ptr param);
@@ -4,47 +4,76 @@
 
 #include "gdbmi_grammar.h"
 #include "gdbmi_parser.h"
-
-int gdbmi_parse(void);
+#include "logger.h"
 
 /* flex */
+typedef void *yyscan_t;
 typedef struct yy_buffer_state *YY_BUFFER_STATE;
-extern YY_BUFFER_STATE gdbmi__scan_string(const char *yy_str);
-extern void gdbmi__delete_buffer(YY_BUFFER_STATE state);
-extern FILE *gdbmi_in;
-extern int gdbmi_lex(void);
-extern char *gdbmi_text;
-extern int gdbmi_lineno;
+extern int gdbmi_lex_init(yyscan_t * scanner);
+extern int gdbmi_lex_destroy(yyscan_t scanner);
+extern YY_BUFFER_STATE gdbmi__scan_bytes(const char *bytes, int len,
+        yyscan_t scanner);
+extern void gdbmi__delete_buffer(YY_BUFFER_STATE state, yyscan_t scanner);
+extern int gdbmi_lex(GDBMI_STYPE * lvalp, yyscan_t scanner);
 
 struct gdbmi_parser {
     char *last_error;
     gdbmi_pstate *mips;
     gdbmi_pdata_ptr pdata_ptr;
+
+    /* The scanner, each line is scanned from a buffer of its own */
+    yyscan_t scanner;
+
+    /* The start of a line, until its newline is pushed */
+    char *line;
+    size_t line_size;
+    size_t line_capacity;
+
+    /* Where the parsed lines go */
+    gdbmi_parser_callback callback;
+    void *context;
+
+    /* The output commands gdbmi_parser_collect put together */
+    gdbmi_output_ptr tree;
+
+    /* The records of the output command not ended by a prompt yet */
+    gdbmi_output_ptr output;
+
+    /* 1 if a line did not parse since the last parse */
+    int parse_failed;
 };
 
 gdbmi_parser_ptr gdbmi_parser_create(void)
 {
     gdbmi_parser_ptr parser;
 
-    parser = (gdbmi_parser_ptr) malloc(sizeof (struct gdbmi_parser));
-    parser->last_error = NULL;
-
+    parser = (gdbmi_parser_ptr) calloc(1, sizeof (struct gdbmi_parser));
     if (!parser) {
-        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+        logger_write_pos(logger, __FILE__, __LINE__, "calloc failed");
         return NULL;
     }
 
     /* Create a new parser instance */
     parser->mips = gdbmi_pstate_new();
-    if (!parser) {
-        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+    if (!parser->mips) {
+        logger_write_pos(logger, __FILE__, __LINE__, "gdbmi_pstate_new failed");
+        gdbmi_parser_destroy(parser);
         return NULL;
     }
 
     /* Create the data the parser parses into */
     parser->pdata_ptr = create_gdbmi_pdata();
     if (!parser->pdata_ptr) {
-        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "create_gdbmi_pdata failed");
+        gdbmi_parser_destroy(parser);
+        return NULL;
+    }
+
+    if (gdbmi_lex_init(&parser->scanner) != 0) {
+        logger_write_pos(logger, __FILE__, __LINE__, "gdbmi_lex_init failed");
+        parser->scanner = NULL;
+        gdbmi_parser_destroy(parser);
         return NULL;
     }
 
@@ -73,58 +102,273 @@ int gdbmi_parser_destroy(gdbmi_parser_ptr parser)
         parser->pdata_ptr = NULL;
     }
 
+    if (parser->scanner) {
+        gdbmi_lex_destroy(parser->scanner);
+        parser->scanner = NULL;
+    }
+
+    free(parser->line);
+    parser->line = NULL;
+
+    destroy_gdbmi_output(parser->tree);
+    parser->tree = NULL;
+
+    destroy_gdbmi_output(parser->output);
+    parser->output = NULL;
+
     free(parser);
     parser = NULL;
     return 0;
 }
 
 int
-gdbmi_parser_parse_string(gdbmi_parser_ptr parser,
-        const char *mi_command, gdbmi_output_ptr * pt, int *parse_failed)
+gdbmi_parser_set_callback(gdbmi_parser_ptr parser,
+        gdbmi_parser_callback callback, void *context)
 {
-    YY_BUFFER_STATE state;
-    int pattern;
-    int mi_status;
-
     if (!parser)
         return -1;
 
-    if (!mi_command)
-        return -1;
+    parser->callback = callback;
+    parser->context = context;
 
-    if (!parse_failed)
-        return -1;
+    return 0;
+}
 
-    /* Initialize output parameters */
-    *pt = 0;
-    *parse_failed = 0;
+/* gdbmi_parser_add_line:
+ * ----------------------
+ *
+ * Keeps the start of a line, until its newline is pushed.
+ */
+static int
+gdbmi_parser_add_line(gdbmi_parser_ptr parser, const char *data, size_t size)
+{
+    size_t capacity = parser->line_capacity ? parser->line_capacity : 128;
+    char *line;
+
+    while (capacity < parser->line_size + size)
+        capacity *= 2;
+
+    if (capacity != parser->line_capacity) {
+        line = (char *) realloc(parser->line, capacity);
+        if (!line) {
+            logger_write_pos(logger, __FILE__, __LINE__, "realloc failed");
+            return -1;
+        }
+
+        parser->line = line;
+        parser->line_capacity = capacity;
+    }
+
+    memcpy(parser->line + parser->line_size, data, size);
+    parser->line_size += size;
+
+    return 0;
+}
+
+/* gdbmi_parser_parse_line:
+ * ------------------------
+ *
+ * Parses a line, including its newline, and hands it to the callback.
+ */
+static void
+gdbmi_parser_parse_line(gdbmi_parser_ptr parser, const char *line,
+        size_t size)
+{
+    YY_BUFFER_STATE state;
+    GDBMI_STYPE value;
+    gdbmi_output_ptr output = NULL;
+    int pattern;
+    int mi_status = YYPUSH_MORE;
 
     parser->pdata_ptr->parsed_one = 0;
+    parser->pdata_ptr->tree = NULL;
 
-    /* Create a new input buffer for flex. */
-    state = gdbmi__scan_string(strdup(mi_command));
+    state = gdbmi__scan_bytes(line, (int) size, parser->scanner);
 
-    /* Create a new input buffer for flex and
-     * iterate over all the tokens. */
+    /* The text of a token is only valid until the next one is scanned,
+     * the grammar uses it as soon as the token is pushed. */
     do {
-        pattern = gdbmi_lex();
+        pattern = gdbmi_lex(&value, parser->scanner);
         if (pattern == 0)
             break;
         mi_status =
-                gdbmi_push_parse(parser->mips, pattern, NULL,
+                gdbmi_push_parse(parser->mips, pattern, &value,
                 parser->pdata_ptr);
-    } while (mi_status == YYPUSH_MORE);
+    } while (mi_status == YYPUSH_MORE && !parser->pdata_ptr->parsed_one);
 
-    /* Parser is done, this should never happen */
-    if (mi_status != YYPUSH_MORE && mi_status != 0) {
-        *parse_failed = 1;
-    } else if (parser->pdata_ptr->parsed_one) {
-        *pt = parser->pdata_ptr->tree;
+    /* Free the scanners buffer */
+    gdbmi__delete_buffer(state, parser->scanner);
+
+    if (parser->pdata_ptr->parsed_one) {
+        output = parser->pdata_ptr->tree;
         parser->pdata_ptr->tree = NULL;
+    } else {
+        if (mi_status == YYPUSH_MORE) {
+            /* The line ended in the middle of a record, start over */
+            gdbmi_pstate_delete(parser->mips);
+            parser->mips = gdbmi_pstate_new();
+        }
+
+        /* Drop what was parsed of the line */
+        reset_gdbmi_arena(parser->pdata_ptr->arena);
     }
 
-    /* Free the scanners buffer */
-    gdbmi__delete_buffer(state);
+    /* The callback does not get the newline */
+    if (size > 0 && line[size - 1] == '\n')
+        --size;
+    if (size > 0 && line[size - 1] == '\r')
+        --size;
+
+    if (parser->callback)
+        parser->callback(parser->context, line, size, output);
+    else
+        destroy_gdbmi_output(output);
+}
+
+int gdbmi_parser_push(gdbmi_parser_ptr parser, const char *data, size_t size)
+{
+    const char *end = data + size;
+    const char *newline;
+
+    if (!parser)
+        return -1;
+
+    if (!data)
+        return -1;
+
+    while (data < end) {
+        newline = (const char *) memchr(data, '\n', end - data);
+        if (!newline)
+            return gdbmi_parser_add_line(parser, data, end - data);
+
+        ++newline;
+
+        /* A line that arrived at once is parsed where it is */
+        if (parser->line_size == 0)
+            gdbmi_parser_parse_line(parser, data, newline - data);
+        else {
+            if (gdbmi_parser_add_line(parser, data, newline - data) == -1)
+                return -1;
+            gdbmi_parser_parse_line(parser, parser->line, parser->line_size);
+            parser->line_size = 0;
+        }
+
+        data = newline;
+    }
+
+    return 0;
+}
+
+/* gdbmi_parser_collect:
+ * ---------------------
+ *
+ * The callback of gdbmi_parser_parse_string and gdbmi_parser_parse_file.
+ * The records are put together into output commands, each one ends with
+ * a prompt.
+ */
+static void
+gdbmi_parser_collect(void *context, const char *line, size_t size,
+        gdbmi_output_ptr output)
+{
+    gdbmi_parser_ptr parser = (gdbmi_parser_ptr) context;
+
+    if (!output) {
+        parser->parse_failed = 1;
+        return;
+    }
+
+    if (!output->oob_record && !output->result_record) {
+        /* The prompt, the output command is complete */
+        if (!parser->output)
+            parser->output = output;
+        else
+            destroy_gdbmi_output(output);
+        parser->tree = append_gdbmi_output(parser->tree, parser->output);
+        parser->output = NULL;
+        return;
+    }
+
+    if (!parser->output) {
+        parser->output = output;
+        return;
+    }
+
+    if (output->oob_record)
+        parser->output->oob_record =
+                append_gdbmi_oob_record(parser->output->oob_record,
+                output->oob_record);
+
+    if (output->result_record)
+        parser->output->result_record = output->result_record;
+
+    /* The records stay in the memory of output */
+    parser->output->arena =
+            append_gdbmi_arena(parser->output->arena, output->arena);
+}
+
+/* gdbmi_parser_collect_data:
+ * --------------------------
+ *
+ * Pushes data to the parser and collects the output commands it completes.
+ */
+static void
+gdbmi_parser_collect_data(gdbmi_parser_ptr parser,
+        const char *data, size_t size)
+{
+    gdbmi_parser_callback callback = parser->callback;
+    void *context = parser->context;
+
+    parser->callback = gdbmi_parser_collect;
+    parser->context = parser;
+
+    gdbmi_parser_push(parser, data, size);
+
+    parser->callback = callback;
+    parser->context = context;
+}
+
+/* gdbmi_parser_take_tree:
+ * -----------------------
+ *
+ * Gives the output commands collected so far to the caller.
+ */
+static void
+gdbmi_parser_take_tree(gdbmi_parser_ptr parser,
+        gdbmi_output_ptr * pt, int *parse_failed)
+{
+    if (parser->parse_failed) {
+        *parse_failed = 1;
+
+        destroy_gdbmi_output(parser->tree);
+        parser->tree = NULL;
+        destroy_gdbmi_output(parser->output);
+        parser->output = NULL;
+        parser->parse_failed = 0;
+    } else {
+        *pt = parser->tree;
+        parser->tree = NULL;
+    }
+}
+
+int
+gdbmi_parser_parse_string(gdbmi_parser_ptr parser,
+        const char *mi_command, gdbmi_output_ptr * pt, int *parse_failed)
+{
+    if (!parser)
+        return -1;
+
+    if (!mi_command)
+        return -1;
+
+    if (!parse_failed)
+        return -1;
+
+    /* Initialize output parameters */
+    *pt = 0;
+    *parse_failed = 0;
+
+    gdbmi_parser_collect_data(parser, mi_command, strlen(mi_command));
+    gdbmi_parser_take_tree(parser, pt, parse_failed);
 
     return 0;
 }
@@ -133,8 +377,9 @@ int
 gdbmi_parser_parse_file(gdbmi_parser_ptr parser,
         const char *mi_command_file, gdbmi_output_ptr * pt, int *parse_failed)
 {
-    int pattern;
-    int mi_status;
+    FILE *file;
+    char buf[4096];
+    size_t size;
 
     if (!parser)
         return -1;
@@ -149,33 +394,20 @@ gdbmi_parser_parse_file(gdbmi_parser_ptr parser,
     *parse_failed = 0;
 
     /* Initialize data */
-    gdbmi_in = fopen(mi_command_file, "r");
+    file = fopen(mi_command_file, "r");
 
-    if (!gdbmi_in) {
-        fprintf(stderr, "%s:%d", __FILE__, __LINE__);
+    if (!file) {
+        logger_write_pos(logger, __FILE__, __LINE__, "fopen %s failed",
+                mi_command_file);
         return -1;
     }
 
-    /* Create a new input buffer for flex and
-     * iterate over all the tokens. */
-    do {
-        pattern = gdbmi_lex();
-        if (pattern == 0)
-            break;
-        mi_status =
-                gdbmi_push_parse(parser->mips, pattern, NULL,
-                parser->pdata_ptr);
-    } while (mi_status == YYPUSH_MORE);
+    while ((size = fread(buf, 1, sizeof (buf), file)) > 0)
+        gdbmi_parser_collect_data(parser, buf, size);
 
-    /* Parser is done, this should never happen */
-    if (mi_status != YYPUSH_MORE && mi_status != 0) {
-        *parse_failed = 1;
-    } else {
-        *pt = parser->pdata_ptr->tree;
-        parser->pdata_ptr->tree = NULL;
-    }
+    fclose(file);
 
-    fclose(gdbmi_in);
+    gdbmi_parser_take_tree(parser, pt, parse_failed);
 
     return 0;
 }
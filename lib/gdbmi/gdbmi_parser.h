@@ -1,6 +1,8 @@
 #ifndef __GDBMI_PARSER_H__
 #define __GDBMI_PARSER_H__
 
+#include <stddef.h>
+
 #include "gdbmi_pt.h"
 
 /* Doxygen headers {{{ */
@@ -15,6 +17,10 @@
  * of one or more lines. That output is an MI parse tree, which represents 
  * the MI command in memory. The application should only use this parse 
  * tree to understand the command.
+ *
+ * The input can also be pushed in chunks of any size as it arrives from GDB,
+ * see gdbmi_parser_push. Each line is then parsed as soon as its newline
+ * arrives and handed to the application with a callback.
  */
 /* }}} */
 
@@ -31,6 +37,29 @@
 struct gdbmi_parser;
 typedef struct gdbmi_parser *gdbmi_parser_ptr;
 
+/**
+ * The function gdbmi_parser_push calls for each line it parsed.
+ *
+ * \param context
+ * The context given to gdbmi_parser_set_callback.
+ *
+ * \param line
+ * The text of the line, without its newline. It is not null terminated and
+ * only valid during the call.
+ *
+ * \param size
+ * The number of bytes in line.
+ *
+ * \param output
+ * The parse tree of the line, or NULL if the line could not be parsed.
+ * It has the one oob_record or result_record the line held. For the prompt
+ * GDB ends the output of a command with, it has neither.
+ *
+ * The callback is responsible for freeing this data structure.
+ */
+typedef void (*gdbmi_parser_callback) (void *context,
+        const char *line, size_t size, gdbmi_output_ptr output);
+
 /**
  * Create a gdbmi_parser context.
  *
@@ -50,6 +79,24 @@ gdbmi_parser_ptr gdbmi_parser_create(void);
  */
 int gdbmi_parser_destroy(gdbmi_parser_ptr parser);
 
+/**
+ * Set the function gdbmi_parser_push hands the parsed lines to.
+ *
+ * \param parser
+ * The gdbmi_parser context to operate on.
+ *
+ * \param callback
+ * The function to call for each line.
+ *
+ * \param context
+ * Passed to callback as is.
+ *
+ * \return
+ * 0 on succes, or -1 on error.
+ */
+int gdbmi_parser_set_callback(gdbmi_parser_ptr parser,
+        gdbmi_parser_callback callback, void *context);
+
 /*@}*/
 
 /**
@@ -60,6 +107,29 @@ int gdbmi_parser_destroy(gdbmi_parser_ptr parser);
 
 /*@{*/
 
+/**
+ * Push data GDB sent to the MI parser.
+ *
+ * The data can end anywhere, even in the middle of a line. The parser keeps
+ * the start of a line until its newline is pushed. Each complete line is
+ * parsed right away and handed to the callback set with
+ * gdbmi_parser_set_callback. A line that does not parse is handed to the
+ * callback without a parse tree, the parser goes on with the next line.
+ *
+ * \param parser
+ * The gdbmi_parser context to operate on.
+ *
+ * \param data
+ * The data to parse, it does not have to be null terminated.
+ *
+ * \param size
+ * The number of bytes in data.
+ *
+ * \return
+ * 0 on succes, or -1 on error.
+ */
+int gdbmi_parser_push(gdbmi_parser_ptr parser, const char *data, size_t size);
+
 /**
  * Tell the MI parser to parse the data.
  *
@@ -67,11 +137,8 @@ int gdbmi_parser_destroy(gdbmi_parser_ptr parser);
  * The normal usage of this function is to call it over and over again with
  * more data and wait for it to return an mi output command.
  *
- * It would be more convienent to allow the parser to parse any random
- * data but that would require flex to be a push flexer. It may even have
- * this feature but since I already changed bison, I don't want to think
- * anymore right now about how to improve this interface. It's good enough
- * for a first shot.
+ * The records are kept by the parser until the prompt that ends the
+ * output command is parsed.
  *
  * \param parser
  * The gdbmi_parser context to operate on.
@@ -1,7 +1,42 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "gdbmi_pt.h"
+#include "logger.h"
+
+/* The size of the first block of an arena, each new block is twice as big
+ * as the one before, up to GDBMI_ARENA_BLOCK_MAX. */
+#define GDBMI_ARENA_BLOCK_SIZE 1024
+#define GDBMI_ARENA_BLOCK_MAX (64 * 1024)
+
+/* Every allocation is aligned for any of the parse tree nodes */
+#define GDBMI_ARENA_ALIGN(size) \
+    (((size) + sizeof (void *) * 2 - 1) & ~(sizeof (void *) * 2 - 1))
+
+struct gdbmi_arena_block {
+    /* The next older block */
+    struct gdbmi_arena_block *next;
+
+    /* The size of the block, including this header */
+    size_t size;
+};
+
+#define GDBMI_ARENA_HEADER_SIZE \
+    GDBMI_ARENA_ALIGN(sizeof (struct gdbmi_arena_block))
+
+struct gdbmi_arena {
+    /* The blocks of the arena, the one allocated from first */
+    struct gdbmi_arena_block *blocks;
+
+    /* The free space of the first block */
+    char *pos;
+    char *end;
+
+    /* The arenas appended to this one. They stay whole, the nodes
+     * allocated from them may still allocate from them. */
+    struct gdbmi_arena *next;
+};
 
 int print_token(long l)
 {
@@ -37,10 +72,267 @@ int print_gdbmi_result_class(enum gdbmi_result_class param)
     return 0;
 }
 
+/* Creating, Destroying and allocating from arena  */
+gdbmi_arena_ptr create_gdbmi_arena(void)
+{
+    return calloc(1, sizeof (struct gdbmi_arena));
+}
+
+int destroy_gdbmi_arena(gdbmi_arena_ptr param)
+{
+    struct gdbmi_arena_block *block, *next_block;
+    gdbmi_arena_ptr next;
+
+    /* The arenas appended to param are freed along with it */
+    for (; param; param = next) {
+        for (block = param->blocks; block; block = next_block) {
+            next_block = block->next;
+            free(block);
+        }
+
+        next = param->next;
+        free(param);
+    }
+
+    return 0;
+}
+
+int reset_gdbmi_arena(gdbmi_arena_ptr param)
+{
+    struct gdbmi_arena_block *block, *next;
+
+    if (!param)
+        return -1;
+
+    destroy_gdbmi_arena(param->next);
+    param->next = NULL;
+
+    if (!param->blocks)
+        return 0;
+
+    /* Keep the newest block, it is the biggest one */
+    for (block = param->blocks->next; block; block = next) {
+        next = block->next;
+        free(block);
+    }
+
+    param->blocks->next = NULL;
+    param->pos = (char *) param->blocks + GDBMI_ARENA_HEADER_SIZE;
+    return 0;
+}
+
+gdbmi_arena_ptr append_gdbmi_arena(gdbmi_arena_ptr list, gdbmi_arena_ptr item)
+{
+    gdbmi_arena_ptr last;
+
+    if (!item)
+        return list;
+
+    if (!list)
+        return item;
+
+    /* The arenas of item go right behind list */
+    for (last = item; last->next; last = last->next);
+    last->next = list->next;
+    list->next = item;
+
+    return list;
+}
+
+/* add_gdbmi_arena_block:
+ * ----------------------
+ *
+ * Allocates a block with room for at least size bytes.
+ */
+static struct gdbmi_arena_block *add_gdbmi_arena_block(gdbmi_arena_ptr arena,
+        size_t size)
+{
+    struct gdbmi_arena_block *block;
+    size_t block_size = GDBMI_ARENA_BLOCK_SIZE;
+
+    if (arena->blocks && arena->blocks->size < GDBMI_ARENA_BLOCK_MAX)
+        block_size = arena->blocks->size * 2;
+    else if (arena->blocks)
+        block_size = arena->blocks->size;
+
+    /* A big allocation gets a block of its own, the current block
+     * keeps being allocated from. */
+    if (arena->blocks && size > block_size / 4) {
+        block = malloc(GDBMI_ARENA_HEADER_SIZE + size);
+        if (!block)
+            return NULL;
+
+        block->size = GDBMI_ARENA_HEADER_SIZE + size;
+        block->next = arena->blocks->next;
+        arena->blocks->next = block;
+        return block;
+    }
+
+    while (block_size < GDBMI_ARENA_HEADER_SIZE + size)
+        block_size *= 2;
+
+    block = malloc(block_size);
+    if (!block)
+        return NULL;
+
+    block->size = block_size;
+    block->next = arena->blocks;
+    arena->blocks = block;
+    arena->pos = (char *) block + GDBMI_ARENA_HEADER_SIZE;
+    arena->end = (char *) block + block_size;
+    return block;
+}
+
+/* get_gdbmi_arena:
+ * ----------------
+ *
+ * Returns size bytes of the arena, they are not initialized.
+ */
+static void *get_gdbmi_arena(gdbmi_arena_ptr arena, size_t size)
+{
+    struct gdbmi_arena_block *block;
+    char *ptr;
+
+    if (!arena)
+        return NULL;
+
+    size = GDBMI_ARENA_ALIGN(size);
+
+    if ((size_t) (arena->end - arena->pos) < size) {
+        block = add_gdbmi_arena_block(arena, size);
+        if (!block) {
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "add_gdbmi_arena_block failed");
+            return NULL;
+        }
+
+        if (block != arena->blocks)
+            return (char *) block + GDBMI_ARENA_HEADER_SIZE;
+    }
+
+    ptr = arena->pos;
+    arena->pos += size;
+    return ptr;
+}
+
+void *gdbmi_arena_alloc(gdbmi_arena_ptr arena, size_t size)
+{
+    void *ptr = get_gdbmi_arena(arena, size);
+
+    if (ptr)
+        memset(ptr, 0, size);
+
+    return ptr;
+}
+
+char *gdbmi_arena_strdup(gdbmi_arena_ptr arena, const char *str)
+{
+    size_t size = strlen(str) + 1;
+    char *ptr = get_gdbmi_arena(arena, size);
+
+    if (ptr)
+        memcpy(ptr, str, size);
+
+    return ptr;
+}
+
+/* Interning variables and finding results by key  */
+
+/* The variables with a key, sorted by name  */
+static const struct gdbmi_key_name {
+    const char *variable;
+    enum gdbmi_key key;
+} gdbmi_key_names[] = {
+    {"BreakpointTable", GDBMI_KEY_BREAKPOINT_TABLE},
+    {"addr", GDBMI_KEY_ADDR},
+    {"bkpt", GDBMI_KEY_BKPT},
+    {"body", GDBMI_KEY_BODY},
+    {"disp", GDBMI_KEY_DISP},
+    {"enabled", GDBMI_KEY_ENABLED},
+    {"exit-code", GDBMI_KEY_EXIT_CODE},
+    {"file", GDBMI_KEY_FILE},
+    {"files", GDBMI_KEY_FILES},
+    {"frame", GDBMI_KEY_FRAME},
+    {"fullname", GDBMI_KEY_FULLNAME},
+    {"func", GDBMI_KEY_FUNC},
+    {"line", GDBMI_KEY_LINE},
+    {"matches", GDBMI_KEY_MATCHES},
+    {"number", GDBMI_KEY_NUMBER},
+    {"reason", GDBMI_KEY_REASON},
+    {"times", GDBMI_KEY_TIMES},
+    {"type", GDBMI_KEY_TYPE},
+    {"value", GDBMI_KEY_VALUE}
+};
+
+enum gdbmi_key gdbmi_key_lookup(const char *variable)
+{
+    int low = 0;
+    int high = sizeof (gdbmi_key_names) / sizeof (gdbmi_key_names[0]) - 1;
+    int middle, cmp;
+
+    if (!variable)
+        return GDBMI_KEY_OTHER;
+
+    while (low <= high) {
+        middle = (low + high) / 2;
+        cmp = strcmp(variable, gdbmi_key_names[middle].variable);
+        if (cmp == 0)
+            return gdbmi_key_names[middle].key;
+        else if (cmp < 0)
+            high = middle - 1;
+        else
+            low = middle + 1;
+    }
+
+    return GDBMI_KEY_OTHER;
+}
+
+gdbmi_result_ptr gdbmi_result_find(gdbmi_result_ptr list, enum gdbmi_key key)
+{
+    for (; list; list = list->next)
+        if (list->key == key)
+            return list;
+
+    return NULL;
+}
+
+gdbmi_result_ptr gdbmi_tuple_find(gdbmi_tuple_ptr tuple, enum gdbmi_key key)
+{
+    gdbmi_result_ptr cur;
+
+    if (!tuple || key == GDBMI_KEY_OTHER)
+        return NULL;
+
+    if (!tuple->index) {
+        tuple->index = gdbmi_arena_alloc(tuple->arena,
+                sizeof (gdbmi_result_ptr) * GDBMI_KEY_LAST);
+        if (!tuple->index)
+            return gdbmi_result_find(tuple->result, key);
+
+        /* The first result of a key wins, like gdbmi_result_find */
+        for (cur = tuple->result; cur; cur = cur->next)
+            if (!tuple->index[cur->key])
+                tuple->index[cur->key] = cur;
+    }
+
+    return tuple->index[key];
+}
+
 /* Creating and  Destroying */
 gdbmi_pdata_ptr create_gdbmi_pdata(void)
 {
-    return calloc(1, sizeof (struct gdbmi_pdata));
+    gdbmi_pdata_ptr pdata = calloc(1, sizeof (struct gdbmi_pdata));
+
+    if (!pdata)
+        return NULL;
+
+    pdata->arena = create_gdbmi_arena();
+    if (!pdata->arena) {
+        free(pdata);
+        return NULL;
+    }
+
+    return pdata;
 }
 
 int destroy_gdbmi_pdata(gdbmi_pdata_ptr param)
@@ -48,36 +340,32 @@ int destroy_gdbmi_pdata(gdbmi_pdata_ptr param)
     if (!param)
         return 0;
 
+    destroy_gdbmi_arena(param->arena);
+    param->arena = NULL;
+
     free(param);
 
     return 0;
 }
 
 /* Creating, Destroying and printing gdbmi_output  */
-gdbmi_output_ptr create_gdbmi_output(void)
+gdbmi_output_ptr create_gdbmi_output(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_output));
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_output));
 }
 
 int destroy_gdbmi_output(gdbmi_output_ptr param)
 {
-    if (!param)
-        return 0;
-
-    if (destroy_gdbmi_oob_record(param->oob_record) == -1)
-        return -1;
-    param->oob_record = NULL;
+    gdbmi_output_ptr next;
 
-    if (destroy_gdbmi_result_record(param->result_record) == -1)
-        return -1;
-    param->result_record = NULL;
-
-    if (destroy_gdbmi_output(param->next) == -1)
-        return -1;
-    param->next = NULL;
+    /* Each output lives in its arena, with all its records */
+    while (param) {
+        next = param->next;
+        if (destroy_gdbmi_arena(param->arena) == -1)
+            return -1;
+        param = next;
+    }
 
-    free(param);
-    param = NULL;
     return 0;
 }
 
@@ -121,24 +409,10 @@ int print_gdbmi_output(gdbmi_output_ptr param)
     return 0;
 }
 
-/* Creating, Destroying and printing record  */
-gdbmi_result_record_ptr create_gdbmi_result_record(void)
-{
-    return calloc(1, sizeof (struct gdbmi_result_record));
-}
-
-int destroy_gdbmi_result_record(gdbmi_result_record_ptr param)
+/* Creating and printing record  */
+gdbmi_result_record_ptr create_gdbmi_result_record(gdbmi_arena_ptr arena)
 {
-    if (!param)
-        return 0;
-
-    if (destroy_gdbmi_result(param->result) == -1)
-        return -1;
-    param->result = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_result_record));
 }
 
 int print_gdbmi_result_record(gdbmi_result_record_ptr param)
@@ -163,33 +437,10 @@ int print_gdbmi_result_record(gdbmi_result_record_ptr param)
     return 0;
 }
 
-/* Creating, Destroying and printing result  */
-gdbmi_result_ptr create_gdbmi_result(void)
+/* Creating and printing result  */
+gdbmi_result_ptr create_gdbmi_result(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_result_record));
-}
-
-int destroy_gdbmi_result(gdbmi_result_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (param->variable) {
-        free(param->variable);
-        param->variable = NULL;
-    }
-
-    if (destroy_gdbmi_value(param->value) == -1)
-        return -1;
-    param->value = NULL;
-
-    if (destroy_gdbmi_result(param->next) == -1)
-        return -1;
-    param->next = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_result));
 }
 
 gdbmi_result_ptr
@@ -246,36 +497,10 @@ int print_gdbmi_oob_record_choice(enum gdbmi_oob_record_choice param)
     return 0;
 }
 
-/* Creating, Destroying and printing oob_record  */
-gdbmi_oob_record_ptr create_gdbmi_oob_record(void)
+/* Creating and printing oob_record  */
+gdbmi_oob_record_ptr create_gdbmi_oob_record(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_oob_record));
-}
-
-int destroy_gdbmi_oob_record(gdbmi_oob_record_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (param->record == GDBMI_ASYNC) {
-        if (destroy_gdbmi_async_record(param->option.async_record) == -1)
-            return -1;
-        param->option.async_record = NULL;
-    } else if (param->record == GDBMI_STREAM) {
-        if (destroy_gdbmi_stream_record(param->option.stream_record) == -1)
-            return -1;
-        param->option.stream_record = NULL;
-    } else {
-        return -1;
-    }
-
-    if (destroy_gdbmi_oob_record(param->next) == -1)
-        return -1;
-    param->next = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_oob_record));
 }
 
 gdbmi_oob_record_ptr
@@ -363,24 +588,10 @@ int print_gdbmi_stream_record_choice(enum gdbmi_stream_record_choice param)
     return 0;
 }
 
-/* Creating, Destroying and printing async_record  */
-gdbmi_async_record_ptr create_gdbmi_async_record(void)
-{
-    return calloc(1, sizeof (struct gdbmi_async_record));
-}
-
-int destroy_gdbmi_async_record(gdbmi_async_record_ptr param)
+/* Creating and printing async_record  */
+gdbmi_async_record_ptr create_gdbmi_async_record(gdbmi_arena_ptr arena)
 {
-    if (!param)
-        return 0;
-
-    if (destroy_gdbmi_result(param->result) == -1)
-        return -1;
-    param->result = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_async_record));
 }
 
 int print_gdbmi_async_record(gdbmi_async_record_ptr param)
@@ -415,6 +626,9 @@ int print_gdbmi_async_class(enum gdbmi_async_class param)
         case GDBMI_STOPPED:
             printf("GDBMI_STOPPED\n");
             break;
+        case GDBMI_UNSUPPORTED:
+            printf("GDBMI_UNSUPPORTED\n");
+            break;
         default:
             return -1;
     };
@@ -441,40 +655,10 @@ int print_gdbmi_value_choice(enum gdbmi_value_choice param)
     return 0;
 }
 
-/* Creating, Destroying and printing value  */
-gdbmi_value_ptr create_gdbmi_value(void)
+/* Creating and printing value  */
+gdbmi_value_ptr create_gdbmi_value(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_value));
-}
-
-int destroy_gdbmi_value(gdbmi_value_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (param->value_choice == GDBMI_CSTRING) {
-        if (param->option.cstring) {
-            free(param->option.cstring);
-            param->option.cstring = NULL;
-        }
-    } else if (param->value_choice == GDBMI_TUPLE) {
-        if (destroy_gdbmi_tuple(param->option.tuple) == -1)
-            return -1;
-        param->option.tuple = NULL;
-    } else if (param->value_choice == GDBMI_LIST) {
-        if (destroy_gdbmi_list(param->option.list) == -1)
-            return -1;
-        param->option.list = NULL;
-    } else
-        return -1;
-
-    if (destroy_gdbmi_value(param->next) == -1)
-        return -1;
-    param->next = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_value));
 }
 
 gdbmi_value_ptr append_gdbmi_value(gdbmi_value_ptr list, gdbmi_value_ptr item)
@@ -525,28 +709,16 @@ int print_gdbmi_value(gdbmi_value_ptr param)
     return 0;
 }
 
-/* Creating, Destroying and printing tuple  */
-gdbmi_tuple_ptr create_gdbmi_tuple(void)
+/* Creating and printing tuple  */
+gdbmi_tuple_ptr create_gdbmi_tuple(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_tuple));
-}
+    gdbmi_tuple_ptr tuple = gdbmi_arena_alloc(arena,
+            sizeof (struct gdbmi_tuple));
 
-int destroy_gdbmi_tuple(gdbmi_tuple_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (destroy_gdbmi_result(param->result) == -1)
-        return -1;
-    param->result = NULL;
-
-    if (destroy_gdbmi_tuple(param->next) == -1)
-        return -1;
-    param->next = NULL;
+    if (tuple)
+        tuple->arena = arena;
 
-    free(param);
-    param = NULL;
-    return 0;
+    return tuple;
 }
 
 int print_gdbmi_tuple(gdbmi_tuple_ptr param)
@@ -581,35 +753,10 @@ int print_gdbmi_list_choice(enum gdbmi_list_choice param)
     return 0;
 }
 
-/* Creating, Destroying and printing list  */
-gdbmi_list_ptr create_gdbmi_list(void)
+/* Creating and printing list  */
+gdbmi_list_ptr create_gdbmi_list(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_list));
-}
-
-int destroy_gdbmi_list(gdbmi_list_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (param->list_choice == GDBMI_VALUE) {
-        if (destroy_gdbmi_value(param->option.value) == -1)
-            return -1;
-        param->option.value = NULL;
-    } else if (param->list_choice == GDBMI_RESULT) {
-        if (destroy_gdbmi_result(param->option.result) == -1)
-            return -1;
-        param->option.result = NULL;
-    } else
-        return -1;
-
-    if (destroy_gdbmi_list(param->next) == -1)
-        return -1;
-    param->next = NULL;
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_list));
 }
 
 gdbmi_list_ptr append_gdbmi_list(gdbmi_list_ptr list, gdbmi_list_ptr item)
@@ -658,25 +805,10 @@ int print_gdbmi_list(gdbmi_list_ptr param)
     return 0;
 }
 
-/* Creating, Destroying and printing stream_record  */
-gdbmi_stream_record_ptr create_gdbmi_stream_record(void)
+/* Creating and printing stream_record  */
+gdbmi_stream_record_ptr create_gdbmi_stream_record(gdbmi_arena_ptr arena)
 {
-    return calloc(1, sizeof (struct gdbmi_stream_record));
-}
-
-int destroy_gdbmi_stream_record(gdbmi_stream_record_ptr param)
-{
-    if (!param)
-        return 0;
-
-    if (param->cstring) {
-        free(param->cstring);
-        param->cstring = NULL;
-    }
-
-    free(param);
-    param = NULL;
-    return 0;
+    return gdbmi_arena_alloc(arena, sizeof (struct gdbmi_stream_record));
 }
 
 int print_gdbmi_stream_record(gdbmi_stream_record_ptr param)
@@ -1,6 +1,8 @@
 #ifndef __GDBMI_PT_H__
 #define __GDBMI_PT_H__
 
+#include <stddef.h>
+
 typedef struct gdbmi_output *gdbmi_output_ptr;
 typedef struct gdbmi_oob_record *gdbmi_oob_record_ptr;
 typedef struct gdbmi_result_record *gdbmi_result_record_ptr;
@@ -12,10 +14,15 @@ typedef struct gdbmi_value *gdbmi_value_ptr;
 typedef struct gdbmi_tuple *gdbmi_tuple_ptr;
 typedef struct gdbmi_list *gdbmi_list_ptr;
 typedef struct gdbmi_pdata *gdbmi_pdata_ptr;
+typedef struct gdbmi_arena *gdbmi_arena_ptr;
 
 struct gdbmi_pdata {
     int parsed_one;
     gdbmi_output_ptr tree;
+
+    /* The arena the line being parsed is allocated from. When the line is
+       an output, the output takes the arena and a new one is created.  */
+    gdbmi_arena_ptr arena;
 };
 
 /* A choice of result's that GDB is capable of producing  */
@@ -38,6 +45,10 @@ struct gdbmi_output {
 
     /* A pointer to the next output  */
     gdbmi_output_ptr next;
+
+    /* The arena this output, its records and their strings are allocated
+       from. Destroying the output frees the arena at once.  */
+    gdbmi_arena_ptr arena;
 };
 
 /* A result record represents the result of a command sent to GDB.  */
@@ -111,8 +122,12 @@ enum gdbmi_stream_record_choice {
     GDBMI_LOG
 };
 
+/* The async classes the parser distinguishes. Any other class GDB sends
+   (running, thread-created, breakpoint-modified, ...) is GDBMI_UNSUPPORTED,
+   so that new GDB notifications do not break the parse.  */
 enum gdbmi_async_class {
-    GDBMI_STOPPED
+    GDBMI_STOPPED,
+    GDBMI_UNSUPPORTED
 };
 
 /* An asyncronous record  */
@@ -129,11 +144,42 @@ struct gdbmi_async_record {
     gdbmi_result_ptr result;
 };
 
+/* The variables the front end looks for. The variable of each result is
+   interned to one of these when it is parsed, so that fields are found by
+   comparing numbers instead of strings.  */
+enum gdbmi_key {
+    /* Any other variable  */
+    GDBMI_KEY_OTHER,
+    GDBMI_KEY_ADDR,
+    GDBMI_KEY_BKPT,
+    GDBMI_KEY_BODY,
+    GDBMI_KEY_BREAKPOINT_TABLE,
+    GDBMI_KEY_DISP,
+    GDBMI_KEY_ENABLED,
+    GDBMI_KEY_EXIT_CODE,
+    GDBMI_KEY_FILE,
+    GDBMI_KEY_FILES,
+    GDBMI_KEY_FRAME,
+    GDBMI_KEY_FULLNAME,
+    GDBMI_KEY_FUNC,
+    GDBMI_KEY_LINE,
+    GDBMI_KEY_MATCHES,
+    GDBMI_KEY_NUMBER,
+    GDBMI_KEY_REASON,
+    GDBMI_KEY_TIMES,
+    GDBMI_KEY_TYPE,
+    GDBMI_KEY_VALUE,
+    /* This is here only to represent the number of keys  */
+    GDBMI_KEY_LAST
+};
+
 /* The result from GDB. This is a linked list. If the result is a key/value 
    pair, then 'variable' is the key and 'value' is the value.  */
 struct gdbmi_result {
     /* Key  */
     char *variable;
+    /* The interned variable  */
+    enum gdbmi_key key;
     /* Value  */
     gdbmi_value_ptr value;
     /* Pointer to the next result  */
@@ -161,6 +207,11 @@ struct gdbmi_value {
 struct gdbmi_tuple {
     gdbmi_result_ptr result;
     gdbmi_tuple_ptr next;
+
+    /* The first result of each key, indexed by key. It is built by the
+       first gdbmi_tuple_find, in the arena the tuple was allocated from.  */
+    gdbmi_result_ptr *index;
+    gdbmi_arena_ptr arena;
 };
 
 enum gdbmi_list_choice {
@@ -187,34 +238,42 @@ struct gdbmi_stream_record {
 /* Print result class  */
 int print_gdbmi_result_class(enum gdbmi_result_class param);
 
+/* Creating, Destroying and allocating from arena. The nodes of a parse
+   tree are allocated from the arena of their output and are only freed
+   all at once, when the output is destroyed.  */
+gdbmi_arena_ptr create_gdbmi_arena(void);
+int destroy_gdbmi_arena(gdbmi_arena_ptr param);
+int reset_gdbmi_arena(gdbmi_arena_ptr param);
+gdbmi_arena_ptr append_gdbmi_arena(gdbmi_arena_ptr list,
+        gdbmi_arena_ptr item);
+void *gdbmi_arena_alloc(gdbmi_arena_ptr arena, size_t size);
+char *gdbmi_arena_strdup(gdbmi_arena_ptr arena, const char *str);
+
 /* Creating and  Destroying */
 gdbmi_pdata_ptr create_gdbmi_pdata(void);
 int destroy_gdbmi_pdata(gdbmi_pdata_ptr param);
 
 /* Creating, Destroying and printing output  */
-gdbmi_output_ptr create_gdbmi_output(void);
+gdbmi_output_ptr create_gdbmi_output(gdbmi_arena_ptr arena);
 int destroy_gdbmi_output(gdbmi_output_ptr param);
 gdbmi_output_ptr append_gdbmi_output(gdbmi_output_ptr list,
         gdbmi_output_ptr item);
 int print_gdbmi_output(gdbmi_output_ptr param);
 
-/* Creating, Destroying and printing record  */
-gdbmi_result_record_ptr create_gdbmi_result_record(void);
-int destroy_gdbmi_result_record(gdbmi_result_record_ptr param);
+/* Creating and printing record  */
+gdbmi_result_record_ptr create_gdbmi_result_record(gdbmi_arena_ptr arena);
 int print_gdbmi_result_record(gdbmi_result_record_ptr param);
 
-/* Creating, Destroying and printing result  */
-gdbmi_result_ptr create_gdbmi_result(void);
-int destroy_gdbmi_result(gdbmi_result_ptr param);
+/* Creating and printing result  */
+gdbmi_result_ptr create_gdbmi_result(gdbmi_arena_ptr arena);
 gdbmi_result_ptr append_gdbmi_result(gdbmi_result_ptr list,
         gdbmi_result_ptr item);
 int print_gdbmi_result(gdbmi_result_ptr param);
 
 int print_gdbmi_oob_record_choice(enum gdbmi_oob_record_choice param);
 
-/* Creating, Destroying and printing oob_record  */
-gdbmi_oob_record_ptr create_gdbmi_oob_record(void);
-int destroy_gdbmi_oob_record(gdbmi_oob_record_ptr param);
+/* Creating and printing oob_record  */
+gdbmi_oob_record_ptr create_gdbmi_oob_record(gdbmi_arena_ptr arena);
 gdbmi_oob_record_ptr append_gdbmi_oob_record(gdbmi_oob_record_ptr list,
         gdbmi_oob_record_ptr item);
 int print_gdbmi_oob_record(gdbmi_oob_record_ptr param);
@@ -223,37 +282,37 @@ int print_gdbmi_async_record_choice(enum gdbmi_async_record_choice param);
 
 int print_gdbmi_stream_record_choice(enum gdbmi_stream_record_choice param);
 
-/* Creating, Destroying and printing async_record  */
-gdbmi_async_record_ptr create_gdbmi_async_record(void);
-int destroy_gdbmi_async_record(gdbmi_async_record_ptr param);
+/* Creating and printing async_record  */
+gdbmi_async_record_ptr create_gdbmi_async_record(gdbmi_arena_ptr arena);
 int print_gdbmi_async_record(gdbmi_async_record_ptr param);
 
 int print_gdbmi_async_class(enum gdbmi_async_class param);
 
 int print_gdbmi_value_choice(enum gdbmi_value_choice param);
 
-/* Creating, Destroying and printing value  */
-gdbmi_value_ptr create_gdbmi_value(void);
-int destroy_gdbmi_value(gdbmi_value_ptr param);
+/* Creating and printing value  */
+gdbmi_value_ptr create_gdbmi_value(gdbmi_arena_ptr arena);
 gdbmi_value_ptr append_gdbmi_value(gdbmi_value_ptr list, gdbmi_value_ptr item);
 int print_gdbmi_value(gdbmi_value_ptr param);
 
-/* Creating, Destroying and printing tuple  */
-gdbmi_tuple_ptr create_gdbmi_tuple(void);
-int destroy_gdbmi_tuple(gdbmi_tuple_ptr param);
+/* Interning variables and finding results by key  */
+enum gdbmi_key gdbmi_key_lookup(const char *variable);
+gdbmi_result_ptr gdbmi_result_find(gdbmi_result_ptr list, enum gdbmi_key key);
+gdbmi_result_ptr gdbmi_tuple_find(gdbmi_tuple_ptr tuple, enum gdbmi_key key);
+
+/* Creating and printing tuple  */
+gdbmi_tuple_ptr create_gdbmi_tuple(gdbmi_arena_ptr arena);
 int print_gdbmi_tuple(gdbmi_tuple_ptr param);
 
 int print_gdbmi_list_choice(enum gdbmi_list_choice param);
 
-/* Creating, Destroying and printing list  */
-gdbmi_list_ptr create_gdbmi_list(void);
-int destroy_gdbmi_list(gdbmi_list_ptr param);
+/* Creating and printing list  */
+gdbmi_list_ptr create_gdbmi_list(gdbmi_arena_ptr arena);
 gdbmi_list_ptr append_gdbmi_list(gdbmi_list_ptr list, gdbmi_list_ptr item);
 int print_gdbmi_list(gdbmi_list_ptr param);
 
-/* Creating, Destroying and printing stream_record  */
-gdbmi_stream_record_ptr create_gdbmi_stream_record(void);
-int destroy_gdbmi_stream_record(gdbmi_stream_record_ptr param);
+/* Creating and printing stream_record  */
+gdbmi_stream_record_ptr create_gdbmi_stream_record(gdbmi_arena_ptr arena);
 int print_gdbmi_stream_record(gdbmi_stream_record_ptr param);
 
 #endif
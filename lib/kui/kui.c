@@ -368,16 +368,39 @@ struct kuictx {
 	 */
     std_list volatile_buffer;
 
+    /**
+	 * Every char read while looking for the current key. Put back onto
+	 * the buffer when the context has to wait for more input.
+	 */
+    std_list sequence_buffer;
+
     /**
 	 * The callback function used to get data read in.
 	 */
     kui_getkey_callback callback;
 
     /**
-	 * Milliseconds to block on a read.
+	 * Milliseconds to wait for the next key of a sequence.
 	 */
     int ms;
 
+    /**
+	 * 1 if a sequence was started, and the context is waiting for the
+	 * next key to decide what it is, otherwise 0.
+	 */
+    int waiting;
+
+    /**
+	 * 1 if the context waited ms milliseconds and should give up
+	 * matching the sequence, otherwise 0.
+	 */
+    int timed_out;
+
+    /**
+	 * The number of chars the callback has read in.
+	 */
+    unsigned long chars_read;
+
     /**
 	 * state data
 	 */
@@ -416,6 +439,10 @@ struct kuictx *kui_create(int stdinfd,
     kctx->state_data = state_data;
     kctx->kui_map_set_list = std_list_create(NULL);
     kctx->ms = ms;
+    kctx->waiting = 0;
+    kctx->timed_out = 0;
+    kctx->chars_read = 0;
+    kctx->sequence_buffer = NULL;
 
     if (!kctx->kui_map_set_list) {
         kui_destroy(kctx);
@@ -438,6 +465,13 @@ struct kuictx *kui_create(int stdinfd,
         return NULL;
     }
 
+    kctx->sequence_buffer = std_list_create(kui_ms_destroy_int_callback);
+
+    if (!kctx->sequence_buffer) {
+        kui_destroy(kctx);
+        return NULL;
+    }
+
     return kctx;
 }
 
@@ -466,6 +500,12 @@ int kui_destroy(struct kuictx *kctx)
         kctx->volatile_buffer = NULL;
     }
 
+    if (kctx->sequence_buffer) {
+        if (std_list_destroy(kctx->sequence_buffer) == -1)
+            ret = -1;
+        kctx->sequence_buffer = NULL;
+    }
+
     free(kctx);
     kctx = NULL;
 
@@ -506,7 +546,7 @@ int kui_add_map_set(struct kuictx *kctx, struct kui_map_set *kui_ms)
  * This basically get's a char from the internal buffer within the kui context
  * or it get's a charachter from the standard input file descriptor.
  *
- * It only blocks for a limited amount of time, waiting for user input.
+ * It never blocks waiting for user input.
  *
  * \param kctx
  * The kui context to operate on.
@@ -517,6 +557,7 @@ int kui_add_map_set(struct kuictx *kctx, struct kui_map_set *kui_ms)
  * @return
  * 1 on success,
  * 0 if no more input, 
+ * 2 if the callback is waiting for more input to decide the key,
  * or -1 on error.
  */
 static int kui_findchar(struct kuictx *kctx, int *key)
@@ -554,7 +595,11 @@ static int kui_findchar(struct kuictx *kctx, int *key)
     } else {
         /* Otherwise, look to read in a char,
          * This function called returns the same conditions as this function*/
-        return kctx->callback(kctx->fd, kctx->ms, kctx->state_data, key);
+        length = kctx->callback(kctx->fd, 0, kctx->state_data, key);
+        if (length == 1)
+            kctx->chars_read++;
+
+        return length;
     }
 
     return 1;
@@ -781,6 +826,44 @@ static int intlen(const int *val)
     return length;
 }
 
+/**
+ * Puts char's read back onto the front of the buffer,
+ * in the order they were read.
+ *
+ * \param kctx
+ * The kui context to operate on.
+ *
+ * \param list
+ * The char's read, the last one read first.
+ *
+ * @return
+ * 0 on success, or -1 on error.
+ */
+static int kui_putback(struct kuictx *kctx, std_list list)
+{
+    std_list_iterator iter;
+
+    for (iter = std_list_begin(list);
+            iter != std_list_end(list); iter = std_list_next(iter)) {
+
+        int *val = malloc(sizeof (int));
+        void *data;
+
+        if (!val)
+            return -1;
+
+        if (std_list_get_data(iter, &data) == -1)
+            return -1;
+
+        *val = *(int *) data;
+
+        if (std_list_prepend(kctx->buffer, val) == -1)
+            return -1;
+    }
+
+    return 0;
+}
+
 /**
  * Updates the kui context buffer.
  *
@@ -850,24 +933,8 @@ static int kui_update_buffer(struct kuictx *kctx,
     }
 
     /* Add the extra char's read */
-    for (iter = std_list_begin(kctx->volatile_buffer);
-            iter != std_list_end(kctx->volatile_buffer);
-            iter = std_list_next(iter)) {
-
-        int *val = malloc(sizeof (int));
-        void *data;
-
-        if (!val)
-            return -1;
-
-        if (std_list_get_data(iter, &data) == -1)
-            return -1;
-
-        *val = *(int *) data;
-
-        if (std_list_prepend(kctx->buffer, val) == -1)
-            return -1;
-    }
+    if (kui_putback(kctx, kctx->volatile_buffer) == -1)
+        return -1;
 
     /* Add the map value */
     if (map_was_found) {
@@ -902,6 +969,7 @@ static int kui_update_buffer(struct kuictx *kctx,
  *
  * @return
  * -1 on error
+ * KUI_WOULD_BLOCK if more input is needed to decide the key
  * The key on success ( valid if map_found == 0 )
  */
 static int kui_findkey(struct kuictx *kctx, int *was_map_found)
@@ -931,6 +999,9 @@ static int kui_findkey(struct kuictx *kctx, int *was_map_found)
     if (std_list_remove_all(kctx->volatile_buffer) == -1)
         return -1;
 
+    if (std_list_remove_all(kctx->sequence_buffer) == -1)
+        return -1;
+
     /* Reset the state data for all of the lists */
     if (std_list_foreach(kctx->kui_map_set_list, kui_reset_state_data,
                     NULL) == -1)
@@ -942,6 +1013,28 @@ static int kui_findkey(struct kuictx *kctx, int *was_map_found)
         if (retval == -1)
             return -1;
 
+        /* If there is no more data ready, and a sequence was started that
+         * may still be completed, wait for the next key. */
+        if (retval == 0 && std_list_length(kctx->sequence_buffer) > 0 &&
+                kctx->ms != 0 && !kctx->timed_out) {
+            kctx->waiting = 1;
+            retval = 2;
+        }
+
+        /* Nothing was typed yet */
+        if (retval == 0 && std_list_length(kctx->sequence_buffer) == 0)
+            retval = 2;
+
+        /* The char's read are put back, and matched again once more
+         * input is available. */
+        if (retval == 2) {
+            if (kui_putback(kctx, kctx->sequence_buffer) == -1)
+                return -1;
+            if (std_list_remove_all(kctx->sequence_buffer) == -1)
+                return -1;
+            return KUI_WOULD_BLOCK;
+        }
+
         /* If there is no more data ready, stop. */
         if (retval == 0)
             break;
@@ -954,6 +1047,13 @@ static int kui_findkey(struct kuictx *kctx, int *was_map_found)
         if (std_list_prepend(kctx->volatile_buffer, val) == -1)
             return -1;
 
+        val = malloc(sizeof (int));
+        if (!val)
+            return -1;
+        *val = key;
+        if (std_list_prepend(kctx->sequence_buffer, val) == -1)
+            return -1;
+
         /* Update each list, with the character read, and the position. */
         if (kui_update_each_list(kctx, key, &map_found) == -1)
             return -1;
@@ -1003,11 +1103,15 @@ int kui_getkey(struct kuictx *kctx)
     do {
         key = kui_findkey(kctx, &map_found);
 
-        if (key == -1)
-            return -1;
+        if (key == -1 || key == KUI_WOULD_BLOCK)
+            return key;
 
     } while (map_found == 1);
 
+    /* The sequence is decided, the next one gets the full time again */
+    kctx->waiting = 0;
+    kctx->timed_out = 0;
+
     return key;
 }
 
@@ -1101,28 +1205,24 @@ int kui_callback(const int fd, const unsigned int ms, const void *obj, int *key)
     if (result == -1)
         return -1;
 
-    if (result == 1) {
-        *key = kui_getkey(kctx);
-        if (*key == -1)
-            return -1;
-    }
-
     /* If there is no data ready, check the I/O */
     if (result == 0) {
         result = io_data_ready(kctx->fd, ms);
         if (result == -1)
             return -1;
 
-        if (result == 1) {
-            *key = kui_getkey(kctx);
-            if (*key == -1)
-                return -1;
-        }
-
         if (result == 0)
             return 0;
     }
 
+    *key = kui_getkey(kctx);
+    if (*key == -1)
+        return -1;
+
+    /* The terminal keys are waiting for the rest of an escape sequence */
+    if (*key == KUI_WOULD_BLOCK)
+        return 2;
+
     return 1;
 }
 
@@ -1236,29 +1336,63 @@ int kui_manager_getkey(struct kui_manager *kuim)
 
 }
 
-int kui_manager_getkey_blocking(struct kui_manager *kuim)
+/**
+ * The context that is waiting for the next key of a sequence.
+ * The terminal keys are checked first, the normal keys can not decide
+ * their sequence until the terminal keys have decided theirs.
+ *
+ * \param kuim
+ * The kui context.
+ *
+ * @return
+ * The waiting context, or NULL if none is waiting.
+ */
+static struct kuictx *kui_manager_waiting_ctx(struct kui_manager *kuim)
 {
+    if (kuim->terminal_keys->waiting)
+        return kuim->terminal_keys;
+
+    if (kuim->normal_keys->waiting)
+        return kuim->normal_keys;
+
+    return NULL;
+}
+
+int kui_manager_get_wait_ms(struct kui_manager *kuim)
+{
+    struct kuictx *kctx;
+
     if (!kuim)
         return -1;
 
-    unsigned long terminal_keys_msec, normal_keys_msec, val;
+    kctx = kui_manager_waiting_ctx(kuim);
+    if (!kctx)
+        return -1;
 
-    /* Get the original values */
-    kui_get_blocking_ms(kuim->terminal_keys, &terminal_keys_msec);
-    kui_get_blocking_ms(kuim->normal_keys, &normal_keys_msec);
+    return kctx->ms;
+}
 
-    /* Set the values to be blocking */
-    kui_set_blocking_ms(kuim->terminal_keys, -1);
-    kui_set_blocking_ms(kuim->normal_keys, -1);
+unsigned long kui_manager_get_chars_read(struct kui_manager *kuim)
+{
+    if (!kuim)
+        return 0;
 
-    /* Get the key */
-    val = kui_getkey(kuim->normal_keys);
+    /* The terminal keys read each char from the descriptor */
+    return kuim->terminal_keys->chars_read;
+}
 
-    /* Restore the values */
-    kui_set_blocking_ms(kuim->terminal_keys, terminal_keys_msec);
-    kui_set_blocking_ms(kuim->normal_keys, normal_keys_msec);
+int kui_manager_timeout(struct kui_manager *kuim)
+{
+    struct kuictx *kctx;
 
-    return val;
+    if (!kuim)
+        return -1;
+
+    kctx = kui_manager_waiting_ctx(kuim);
+    if (kctx)
+        kctx->timed_out = 1;
+
+    return 0;
 }
 
 int kui_manager_set_terminal_escape_sequence_timeout(struct kui_manager *kuim,
@@ -17,6 +17,13 @@
  */
 /* }}} */
 
+/**
+ * Returned instead of a key when the key typed so far could be the
+ * beginning of a longer sequence, and more input is needed to decide.
+ * Keys read are in the range of a char, or are CGDB_KEY_* values.
+ */
+#define KUI_WOULD_BLOCK (-1000)
+
 /* struct kui_map {{{ */
 /******************************************************************************/
 /**
@@ -261,6 +268,7 @@ struct kuictx;
  * Must return 
  * 1 on success,
  * 0 if no more input, 
+ * 2 if input was read, but more is needed to decide the key,
  * or -1 on error.
  */
 typedef int (*kui_getkey_callback) (const int fd,
@@ -276,9 +284,8 @@ typedef int (*kui_getkey_callback) (const int fd,
  * The function that libkui calls to have 1 char read.
  *
  * \param ms
- * The number of milliseconds that this context should block while 
- * attempting to match a mapping by waiting for the user to type
- * the next key.
+ * The number of milliseconds that this context should wait while 
+ * attempting to match a mapping for the user to type the next key.
  *
  * \param state_data
  * This is a piece of data that is not looked at by this context. It
@@ -366,27 +373,30 @@ int kui_cangetkey(struct kuictx *kctx);
 /**
  * Get's the next key for the application to process.
  *
+ * This never blocks. If a sequence is started but not finished, the
+ * characters read are kept, and the context waits for the next key. 
+ *
  * \param kctx
  * The kui context.
  *
  * @return
- * -1 on error, otherwise, a valid key.
- *  A key can either be a normal ascii key, or a CGDB_KEY_* value.
+ * -1 on error, KUI_WOULD_BLOCK if more input is needed, otherwise, a 
+ *  valid key. A key can either be a normal ascii key, or a CGDB_KEY_* value.
  */
 
 int kui_getkey(struct kuictx *kctx);
 
 /**
  * Tell's the kui context the maximum number of milliseconds that it is allowed
- * to block while waiting to complete a mapping.
+ * to wait to complete a mapping.
  *
  * \param kctx
  * The kui context.
  *
  * \param msec
- * The maximum number of milliseconds to block while waiting to complete a map
+ * The maximum number of milliseconds to wait to complete a map
  * The value 0 causes no waiting.
- * The value -1 causes an indefinate amount of blocking.
+ * The value -1 causes an indefinate amount of waiting.
  *
  * \return
  * 0 on success, or -1 on error.
@@ -394,7 +404,7 @@ int kui_getkey(struct kuictx *kctx);
 int kui_set_blocking_ms(struct kuictx *kctx, unsigned long msec);
 
 /**
- * Get the number of milliseconds that the kui should block while waiting to
+ * Get the number of milliseconds that the kui should wait to
  * complete a mapping. This value is set with kui_set_blocking_ms.
  *
  * \param kctx
@@ -524,46 +534,71 @@ int kui_manager_cangetkey(struct kui_manager *kuim);
 /**
  * Get's the next key for the application to process. 
  *
- * In the event that this is called when kui_manager_cangetkey returns 0, 
- * and the caller didn't check the input file handle to determine if there
- * was input, this is a non-blocking call. Use kui_manager_getkey_blocking
- * if you want the semantics to be a blocking call.
+ * This is a non-blocking call. When the keys typed so far are the start
+ * of a terminal escape sequence or a mapping, KUI_WOULD_BLOCK is returned.
+ * Call this again when there is more input, or after the time returned by
+ * kui_manager_get_wait_ms has passed and kui_manager_timeout was called.
  *
  * \param kuim
  * The kui context.
  *
  * @return
- * -1 on error, otherwise, a valid key.
- *  A key can either be a normal ascii key, or a CGDB_KEY_* value.
+ * -1 on error, KUI_WOULD_BLOCK if more input is needed, otherwise, a 
+ *  valid key. A key can either be a normal ascii key, or a CGDB_KEY_* value.
  */
 int kui_manager_getkey(struct kui_manager *kuim);
 
 /**
- * This is the same as kui_manager_getkey excpet that if no data is ready
- * to be read, this call will block until data is ready.
+ * Get's the number of milliseconds the kui waits for the rest of a sequence,
+ * after kui_manager_getkey returned KUI_WOULD_BLOCK.
  *
  * \param kuim
  * The kui context.
  *
  * \return
- * -1 on error, otherwise, a valid key.
- *  A key can either be a normal ascii key, or a CGDB_KEY_* value.
+ * The milliseconds to wait, or -1 if the kui is not waiting on a timeout.
+ */
+int kui_manager_get_wait_ms(struct kui_manager *kuim);
+
+/**
+ * Get's the number of chars the kui has read from the descriptor so far.
+ * When this changes while the kui is waiting for the rest of a sequence,
+ * the sequence was extended by the chars typed since.
+ *
+ * \param kuim
+ * The kui context.
+ *
+ * \return
+ * The number of chars read.
+ */
+unsigned long kui_manager_get_chars_read(struct kui_manager *kuim);
+
+/**
+ * Tell's the kui that the time returned by kui_manager_get_wait_ms has
+ * passed. The next call to kui_manager_getkey returns the keys typed so far
+ * as they are, instead of waiting for the rest of the sequence.
+ *
+ * \param kuim
+ * The kui context.
+ *
+ * \return
+ * 0 on success, or -1 on error.
  */
-int kui_manager_getkey_blocking(struct kui_manager *kuim);
+int kui_manager_timeout(struct kui_manager *kuim);
 
 /**
  * Set's the terminal escape sequence time out value.
- * This is used to tell CGDB how long to block when looking to match terminal
+ * This is used to tell CGDB how long to wait when looking to match terminal
  * escape sequences. For instance, in order to get F11, Maybe it's necessary
  * for the charachters 27(ESC) 80(P) 81(Q) to get sent. So, if the user types 
- * these within msec each, then CGDB_KEY_F11 get's returned, otherwise the 
+ * these within msec, then CGDB_KEY_F11 get's returned, otherwise the 
  * key's are returned as typed.
  *
  * \param kuim
  * The kui context
  *
  * \param msec
- * The maximum number of milliseconds to block while waiting to complete a 
+ * The maximum number of milliseconds to wait to complete a 
  * terminal escape sequence.
  *
  * \return
@@ -579,7 +614,7 @@ int kui_manager_set_terminal_escape_sequence_timeout(struct kui_manager *kuim,
  * The kui context
  *
  * \param msec
- * The maximum number of milliseconds to block while waiting to complete a 
+ * The maximum number of milliseconds to wait to complete a 
  * mapping sequence.
  *
  * \return
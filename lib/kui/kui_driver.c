@@ -214,6 +214,8 @@ void main_loop(struct kui_manager *i)
     int max;
     fd_set rfds;
     int result;
+    int wait;
+    struct timeval timeout;
 
     max = STDIN_FILENO;
 
@@ -221,9 +223,17 @@ void main_loop(struct kui_manager *i)
         FD_ZERO(&rfds);
         FD_SET(STDIN_FILENO, &rfds);
 
-        fprintf(stderr, "\r\n(kui) ");
+        /* Wait no longer than the kui waits for the rest of a sequence */
+        wait = kui_manager_get_wait_ms(i);
+        if (wait == -1)
+            fprintf(stderr, "\r\n(kui) ");
+        else {
+            timeout.tv_sec = wait / 1000;
+            timeout.tv_usec = (wait % 1000) * 1000;
+        }
 
-        result = select(max + 1, &rfds, NULL, NULL, NULL);
+        result = select(max + 1, &rfds, NULL, NULL,
+                (wait == -1) ? NULL : &timeout);
 
         /* if the signal interuppted system call keep going */
         if (result == -1 && errno == EINTR)
@@ -231,7 +241,11 @@ void main_loop(struct kui_manager *i)
         else if (result == -1)  /* on error ... must die -> stupid OS */
             fprintf(stderr, "%s:%d select failed\n", __FILE__, __LINE__);
 
-        if (FD_ISSET(STDIN_FILENO, &rfds)) {
+        /* The sequence was not completed in time */
+        if (result == 0)
+            kui_manager_timeout(i);
+
+        if (result == 0 || FD_ISSET(STDIN_FILENO, &rfds)) {
             while (1) {
                 int c = kui_manager_getkey(i);
 
@@ -240,6 +254,9 @@ void main_loop(struct kui_manager *i)
                     return;
                 }
 
+                if (c == KUI_WOULD_BLOCK)
+                    break;
+
                 if (c == 'q') {
                     fprintf(stderr, "User aborted\r\n");
                     return;
@@ -31,6 +31,7 @@
 #include "a2-tgdb.h"
 #include "queue.h"
 #include "tgdb_list.h"
+#include "std_hash.h"
 #include "annotate_two.h"
 
 /**
@@ -60,6 +61,9 @@ struct commands {
   /** A list of breakpoints already parsed.  */
     struct tgdb_list *breakpoint_list;
 
+  /** The breakpoints last sent to the gui, keyed by "file:line".  */
+    struct std_hashtable *breakpoints;
+
   /** The current breakpoint being parsed.  */
     struct ibuf *breakpoint_string;
 
@@ -141,6 +145,9 @@ struct commands {
     int source_relative_prefix_length;
 };
 
+int free_breakpoint(void *item);
+int free_char_star(void *item);
+
 struct commands *commands_initialize(void)
 {
     struct commands *c =
@@ -154,6 +161,7 @@ struct commands *commands_initialize(void)
     c->cur_field_num = 0;
 
     c->breakpoint_list = tgdb_list_init();
+    c->breakpoints = tgdb_types_breakpoint_table_create();
     c->breakpoint_string = ibuf_init();
     c->breakpoint_table = 0;
     c->breakpoint_enabled = 0;
@@ -227,6 +235,7 @@ void commands_shutdown(struct commands *c)
 
     tgdb_list_free(c->breakpoint_list, free_breakpoint);
     tgdb_list_destroy(c->breakpoint_list);
+    std_hash_table_destroy(c->breakpoints);
 
     ibuf_free(c->breakpoint_string);
     c->breakpoint_string = NULL;
@@ -307,10 +316,7 @@ commands_parse_source(struct commands *c,
         char *temp = cgdb_malloc(sizeof (char) * (length + 1));
 
         if (strncmp("source ", copy, 7) == 0 && length > 7) {
-            int j;
-
-            for (j = 7; j < length; j++)
-                ibuf_addchar(file, copy[j]);
+            ibuf_addn(file, copy + 7, length - 7);
         } else {
             logger_write_pos(logger, __FILE__, __LINE__,
                     "Could not get file name out of line (%s)", buf);
@@ -434,16 +440,22 @@ commands_set_state(struct commands *c,
                     logger_write_pos(logger, __FILE__, __LINE__,
                             "parse_breakpoint error");
             {
-                struct tgdb_response *response = (struct tgdb_response *)
-                        cgdb_malloc(sizeof (struct tgdb_response));
-
-                response->header = TGDB_UPDATE_BREAKPOINTS;
-                response->choice.update_breakpoints.breakpoint_list =
-                        c->breakpoint_list;
-
-                /* At this point, annotate needs to send the breakpoints to the gui.
-                 * All of the valid breakpoints are stored in breakpoint_queue. */
-                tgdb_types_append_command(list, response);
+                struct tgdb_list *delta =
+                        tgdb_types_breakpoint_delta(&c->breakpoints,
+                        c->breakpoint_list);
+                struct tgdb_response *response;
+
+                /* Only the changes are sent to the gui, if there are any */
+                if (tgdb_list_size(delta) == 0) {
+                    tgdb_list_destroy(delta);
+                } else {
+                    response = (struct tgdb_response *)
+                            cgdb_malloc(sizeof (struct tgdb_response));
+                    response->header = TGDB_UPDATE_BREAKPOINTS;
+                    response->choice.update_breakpoints.breakpoint_list =
+                            delta;
+                    tgdb_types_append_command(list, response);
+                }
             }
 
             ibuf_clear(c->breakpoint_string);
@@ -597,50 +609,70 @@ commands_send_source_relative_source_file(struct commands *c,
     tgdb_types_append_command(list, response);
 }
 
+/* commands_process_info_source_line:
+ * ----------------------------------
+ *
+ * Looks for the absolute or relative path in the line of 'info source'
+ * output that is in info_source_string.
+ */
+static void commands_process_info_source_line(struct commands *c)
+{
+    const char *line = ibuf_get(c->info_source_string);
+    unsigned long length = ibuf_length(c->info_source_string);
+
+    /* This is the line containing the absolute path to the source file */
+    if (length >= c->source_prefix_length &&
+            strncmp(line, c->source_prefix,
+                    c->source_prefix_length) == 0) {
+        ibuf_add(c->info_source_absolute_path,
+                line + c->source_prefix_length);
+        c->info_source_ready = 1;
+        ibuf_clear(c->info_source_string);
+
+        /* commands_finalize_command will use the populated data */
+
+        /* This is the line contatining the relative path to the source file */
+    } else if (length >= c->source_relative_prefix_length &&
+            strncmp(line, c->source_relative_prefix,
+                    c->source_relative_prefix_length) == 0) {
+        ibuf_add(c->info_source_relative_path,
+                line + c->source_relative_prefix_length);
+        ibuf_clear(c->info_source_string);
+    } else
+        ibuf_clear(c->info_source_string);
+}
+
 /* commands_process_info_source:
  * -----------------------------
  *
  * This function is capable of parsing the output of 'info source'.
  * It can get both the absolute and relative path to the source file.
+ * The '\r' characters are dropped, each line is parsed when its '\n'
+ * is seen.
  */
 static void
-commands_process_info_source(struct commands *c, struct tgdb_list *list, char a)
+commands_process_info_source(struct commands *c, struct tgdb_list *list,
+        const char *data, size_t size)
 {
-    unsigned long length;
-    static char *info_ptr;
+    const char *end = data + size, *eol, *cr;
 
-    if (c->info_source_ready)   /* Already found */
-        return;
+    while (data < end && !c->info_source_ready) {
+        eol = memchr(data, '\n', end - data);
+        if (!eol)
+            eol = end;
 
-    info_ptr = ibuf_get(c->info_source_string);
-    length = ibuf_length(c->info_source_string);
+        while ((cr = memchr(data, '\r', eol - data)) != NULL) {
+            ibuf_addn(c->info_source_string, data, cr - data);
+            data = cr + 1;
+        }
+        ibuf_addn(c->info_source_string, data, eol - data);
 
-    if (a == '\r')
-        return;
+        if (eol == end)
+            break;
 
-    if (a == '\n') {
-        /* This is the line containing the absolute path to the source file */
-        if (length >= c->source_prefix_length &&
-                strncmp(info_ptr, c->source_prefix,
-                        c->source_prefix_length) == 0) {
-            ibuf_add(c->info_source_absolute_path,
-                    info_ptr + c->source_prefix_length);
-            c->info_source_ready = 1;
-            ibuf_clear(c->info_source_string);
-
-            /* commands_finalize_command will use the populated data */
-
-            /* This is the line contatining the relative path to the source file */
-        } else if (length >= c->source_relative_prefix_length &&
-                strncmp(info_ptr, c->source_relative_prefix,
-                        c->source_relative_prefix_length) == 0) {
-            ibuf_add(c->info_source_relative_path,
-                    info_ptr + c->source_relative_prefix_length);
-            ibuf_clear(c->info_source_string);
-        } else
-            ibuf_clear(c->info_source_string);
-    } else
-        ibuf_addchar(c->info_source_string, a);
+        commands_process_info_source_line(c);
+        data = eol + 1;
+    }
 }
 
 static void commands_process_source_line(struct commands *c)
@@ -666,16 +698,25 @@ static void commands_process_source_line(struct commands *c)
 }
 
 /* process's source files */
-static void commands_process_sources(struct commands *c, char a)
+static void commands_process_sources(struct commands *c,
+        const char *data, size_t size)
 {
     static const char *sourcesReadyString = "Source files for which symbols ";
     static const int sourcesReadyStringLength = 31;
     static char *info_ptr;
+    const char *end = data + size, *eol;
 
-    ibuf_addchar(c->info_sources_string, a);
+    while (data < end) {
+        eol = memchr(data, '\n', end - data);
+        if (!eol) {
+            ibuf_addn(c->info_sources_string, data, end - data);
+            break;
+        }
+
+        /* add the line without the '\n' */
+        ibuf_addn(c->info_sources_string, data, eol - data);
+        data = eol + 1;
 
-    if (a == '\n') {
-        ibuf_delchar(c->info_sources_string);   /* remove '\n' and null terminate */
         /* valid lines are 
          * 1. after the first line,
          * 2. do not end in ':' 
@@ -706,16 +747,26 @@ static void commands_process_completion(struct commands *c)
      * implementations that are derived from GDB.
      */
     if (strncmp(ptr, scomplete, strlen(scomplete)) != 0)
-        tgdb_list_append(c->tab_completions, strdup(ptr));
+        tgdb_list_append(c->tab_completions,
+                ibuf_steal(c->tab_completion_string));
 }
 
-/* process's source files */
-static void commands_process_complete(struct commands *c, char a)
+/* process's completions */
+static void commands_process_complete(struct commands *c,
+        const char *data, size_t size)
 {
-    ibuf_addchar(c->tab_completion_string, a);
+    const char *end = data + size, *eol;
 
-    if (a == '\n') {
-        ibuf_delchar(c->tab_completion_string); /* remove '\n' and null terminate */
+    while (data < end) {
+        eol = memchr(data, '\n', end - data);
+        if (!eol) {
+            ibuf_addn(c->tab_completion_string, data, end - data);
+            break;
+        }
+
+        /* add the line without the '\n' */
+        ibuf_addn(c->tab_completion_string, data, eol - data);
+        data = eol + 1;
 
         if (ibuf_length(c->tab_completion_string) > 0)
             commands_process_completion(c);
@@ -759,22 +810,22 @@ void commands_send_gui_completions(struct commands *c, struct tgdb_list *list)
     tgdb_types_append_command(list, response);
 }
 
-void commands_process(struct commands *c, char a, struct tgdb_list *list)
+void commands_process(struct commands *c, const char *data, size_t size,
+        struct tgdb_list *list)
 {
     if (commands_get_state(c) == INFO_SOURCES) {
-        commands_process_sources(c, a);
+        commands_process_sources(c, data, size);
     } else if (commands_get_state(c) == COMPLETE) {
-        commands_process_complete(c, a);
+        commands_process_complete(c, data, size);
     } else if (commands_get_state(c) == INFO_LIST) {
         /* do nothing with data */
     } else if (commands_get_state(c) == INFO_SOURCE_FILENAME_PAIR
             || commands_get_state(c) == INFO_SOURCE_RELATIVE) {
-        commands_process_info_source(c, list, a);
+        commands_process_info_source(c, list, data, size);
     } else if (c->breakpoint_table && c->cur_command_state == FIELD && c->cur_field_num == 5) { /* the file name and line num */
-        if (a != '\n' || a != '\r')
-            ibuf_addchar(c->breakpoint_string, a);
+        ibuf_addn(c->breakpoint_string, data, size);
     } else if (c->breakpoint_table && c->cur_command_state == FIELD
-            && c->cur_field_num == 3 && a == 'y') {
+            && c->cur_field_num == 3 && memchr(data, 'y', size)) {
         c->breakpoint_enabled = 1;
     }
 }
@@ -87,10 +87,12 @@ int commands_issue_command(struct commands *c,
 /* commands_process: This function recieves the output from gdb when gdb
  *                   is running a command on behalf of this package.
  *
- *    a     -> the character recieved from gdb.
+ *    data  -> the characters recieved from gdb, not null terminated.
+ *    size  -> the number of characters in data.
  *    com   -> commands to give back to gdb.
  */
-void commands_process(struct commands *c, char a, struct tgdb_list *list);
+void commands_process(struct commands *c, const char *data, size_t size,
+        struct tgdb_list *list);
 
 /* commands_list_command_finished: Returns to the gui the absolute path of
  *                                  the filename requested.
@@ -129,26 +129,35 @@ void data_set_state(struct annotate_two *a2, enum internal_state state)
 }
 
 void data_process(struct annotate_two *a2,
-        char a, char *buf, int *n, struct tgdb_list *list)
+        const char *data, size_t size, char *buf, int *n,
+        struct tgdb_list *list)
 {
+    size_t length;
+
     switch (a2->data->data_state) {
         case VOID:
-            buf[(*n)++] = a;
+            memcpy(buf + *n, data, size);
+            *n += size;
             break;
         case AT_PROMPT:
-            a2->data->gdb_prompt[a2->data->gdb_prompt_size++] = a;
-/*            buf[(*n)++] = a;*/
+            /* Leave room for the NUL added by data_set_state */
+            length = GDB_PROMPT_SIZE - 1 - a2->data->gdb_prompt_size;
+            if (size < length)
+                length = size;
+
+            memcpy(a2->data->gdb_prompt + a2->data->gdb_prompt_size,
+                    data, length);
+            a2->data->gdb_prompt_size += length;
             break;
         case USER_AT_PROMPT:
             break;
         case GUI_COMMAND:
+            memcpy(buf + *n, data, size);
+            *n += size;
+            break;
         case INTERNAL_COMMAND:
-            if (a2->data->data_state == INTERNAL_COMMAND)
-                commands_process(a2->c, a, list);
-            else if (a2->data->data_state == GUI_COMMAND)
-                buf[(*n)++] = a;
-
-            break;              /* do nothing */
+            commands_process(a2->c, data, size, list);
+            break;
         case USER_COMMAND:
             break;
         case POST_PROMPT:
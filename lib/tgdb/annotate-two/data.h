@@ -2,7 +2,7 @@
  * -----
  *
  * This unit recieves all of the data that was not an annotation from gdb.
- * It gets the data 1 character at a time and passes it along to the
+ * It gets the data in runs of characters and passes it along to the
  * commands unit when necessary.
  *
  */
@@ -45,15 +45,18 @@ extern "C" {
     enum internal_state data_get_state(struct data *d);
 
 /* data_process:  This process's every character that is outputted from gdb not 
- *                including annotations.
+ *                including annotations. The characters are passed in runs, 
+ *                that are copied to buf at once when they go to the user.
  *
- *    a     -  A character read from gdb.
+ *    data  -  The characters read from gdb.
+ *    size  -  The number of characters in data.
  *    buf   -  This is a buffer of information that will get returned to the user
- *             based on whatever the character a was.
+ *             based on whatever the characters were.
  *    n     -  This is the current size of buf.
  */
     void data_process(struct annotate_two *a2,
-            char a, char *buf, int *n, struct tgdb_list *list);
+            const char *data, size_t size, char *buf, int *n,
+            struct tgdb_list *list);
 
 #ifdef __cplusplus
 }
@@ -80,113 +80,161 @@ void state_machine_shutdown(struct state_machine *sm)
     sm = NULL;
 }
 
+/* a2_handle_char: Moves the state machine along by a single character.
+ * ---------------
+ *
+ *   c:        The character read from gdb
+ *   gui_data: The data that was not an annotation is added here
+ *   counter:  The size of gui_data
+ */
+static void a2_handle_char(struct annotate_two *a2, struct state_machine *sm,
+        char c, char *gui_data, int *counter, struct tgdb_list *command_list)
+{
+    switch (c) {
+            /* Ignore all car returns outputted by gdb */
+        case '\r':
+            break;
+        case '\n':
+            switch (sm->tgdb_state) {
+                case DATA:
+                    sm->tgdb_state = NEW_LINE;
+                    break;
+                case NEW_LINE:
+                    sm->tgdb_state = NEW_LINE;
+                    data_process(a2, "\n", 1, gui_data, counter, command_list);
+                    break;
+                case CONTROL_Z:
+                    sm->tgdb_state = DATA;
+                    data_process(a2, "\n", 1, gui_data, counter, command_list);
+                    data_process(a2, "\032", 1, gui_data, counter,
+                            command_list);
+                    break;
+                case ANNOTATION:   /* Found an annotation */
+                    sm->tgdb_state = NL_DATA;
+                    tgdb_parse_annotation(a2, ibuf_get(sm->tgdb_buffer),
+                            ibuf_length(sm->tgdb_buffer), command_list);
+                    ibuf_clear(sm->tgdb_buffer);
+                    break;
+                case NL_DATA:
+                    sm->tgdb_state = NEW_LINE;
+                    break;
+                default:
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "Bad state transition");
+                    break;
+            }               /* end switch */
+            break;
+        case '\032':
+            switch (sm->tgdb_state) {
+                case DATA:
+                    sm->tgdb_state = DATA;
+                    data_process(a2, "\032", 1, gui_data, counter,
+                            command_list);
+                    break;
+                case NEW_LINE:
+                    sm->tgdb_state = CONTROL_Z;
+                    break;
+                case NL_DATA:
+                    sm->tgdb_state = CONTROL_Z;
+                    break;
+                case CONTROL_Z:
+                    sm->tgdb_state = ANNOTATION;
+                    break;
+                case ANNOTATION:
+                    ibuf_addchar(sm->tgdb_buffer, c);
+                    break;
+                default:
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "Bad state transition");
+                    break;
+            }               /* end switch */
+            break;
+        default:
+            switch (sm->tgdb_state) {
+                case DATA:
+                    data_process(a2, &c, 1, gui_data, counter, command_list);
+                    break;
+                case NL_DATA:
+                    sm->tgdb_state = DATA;
+                    data_process(a2, &c, 1, gui_data, counter, command_list);
+                    break;
+                case NEW_LINE:
+                    sm->tgdb_state = DATA;
+                    data_process(a2, "\n", 1, gui_data, counter, command_list);
+                    data_process(a2, &c, 1, gui_data, counter, command_list);
+                    break;
+                case CONTROL_Z:
+                    sm->tgdb_state = DATA;
+                    data_process(a2, "\n", 1, gui_data, counter, command_list);
+                    data_process(a2, "\032", 1, gui_data, counter,
+                            command_list);
+                    data_process(a2, &c, 1, gui_data, counter, command_list);
+                    break;
+                case ANNOTATION:
+                    ibuf_addchar(sm->tgdb_buffer, c);
+                    break;
+                default:
+                    logger_write_pos(logger, __FILE__, __LINE__,
+                            "Bad state transition");
+                    break;
+            }               /* end switch */
+            break;
+    }                       /* end switch */
+}
+
+/* a2_run_length: Finds where a run of characters ends, that the state 
+ * -------------- machine passes along as they are while in the DATA or 
+ *                ANNOTATION state. That is, up to the next '\r' or '\n'.
+ *
+ *   data: The characters to look at
+ *   size: The number of characters in data
+ *
+ * Return Value: The length of the run.
+ */
+static size_t a2_run_length(const char *data, size_t size)
+{
+    const char *nl = (const char *) memchr(data, '\n', size);
+    const char *cr;
+
+    if (nl)
+        size = nl - data;
+
+    cr = (const char *) memchr(data, '\r', size);
+    if (cr)
+        size = cr - data;
+
+    return size;
+}
+
 int a2_handle_data(struct annotate_two *a2, struct state_machine *sm,
         const char *data, const size_t size,
         char *gui_data, size_t * gui_size, struct tgdb_list *command_list)
 {
-    int i, counter = 0;
+    size_t i = 0, length;
+    int counter = 0;
 
     /* track state to find next file and line number */
-    for (i = 0; i < size; ++i) {
-        switch (data[i]) {
-                /* Ignore all car returns outputted by gdb */
-            case '\r':
-                break;
-            case '\n':
-                switch (sm->tgdb_state) {
-                    case DATA:
-                        sm->tgdb_state = NEW_LINE;
-                        break;
-                    case NEW_LINE:
-                        sm->tgdb_state = NEW_LINE;
-                        data_process(a2, '\n', gui_data, &counter,
-                                command_list);
-                        break;
-                    case CONTROL_Z:
-                        sm->tgdb_state = DATA;
-                        data_process(a2, '\n', gui_data, &counter,
-                                command_list);
-                        data_process(a2, '\032', gui_data, &counter,
-                                command_list);
-                        break;
-                    case ANNOTATION:   /* Found an annotation */
-                        sm->tgdb_state = NL_DATA;
-                        tgdb_parse_annotation(a2, ibuf_get(sm->tgdb_buffer),
-                                ibuf_length(sm->tgdb_buffer), command_list);
-                        ibuf_clear(sm->tgdb_buffer);
-                        break;
-                    case NL_DATA:
-                        sm->tgdb_state = NEW_LINE;
-                        break;
-                    default:
-                        logger_write_pos(logger, __FILE__, __LINE__,
-                                "Bad state transition");
-                        break;
-                }               /* end switch */
-                break;
-            case '\032':
-                switch (sm->tgdb_state) {
-                    case DATA:
-                        sm->tgdb_state = DATA;
-                        data_process(a2, '\032', gui_data, &counter,
-                                command_list);
-                        break;
-                    case NEW_LINE:
-                        sm->tgdb_state = CONTROL_Z;
-                        break;
-                    case NL_DATA:
-                        sm->tgdb_state = CONTROL_Z;
-                        break;
-                    case CONTROL_Z:
-                        sm->tgdb_state = ANNOTATION;
-                        break;
-                    case ANNOTATION:
-                        ibuf_addchar(sm->tgdb_buffer, data[i]);
-                        break;
-                    default:
-                        logger_write_pos(logger, __FILE__, __LINE__,
-                                "Bad state transition");
-                        break;
-                }               /* end switch */
-                break;
-            default:
-                switch (sm->tgdb_state) {
-                    case DATA:
-                        data_process(a2, data[i], gui_data, &counter,
-                                command_list);
-                        break;
-                    case NL_DATA:
-                        sm->tgdb_state = DATA;
-                        data_process(a2, data[i], gui_data, &counter,
-                                command_list);
-                        break;
-                    case NEW_LINE:
-                        sm->tgdb_state = DATA;
-                        data_process(a2, '\n', gui_data, &counter,
-                                command_list);
-                        data_process(a2, data[i], gui_data, &counter,
-                                command_list);
-                        break;
-                    case CONTROL_Z:
-                        sm->tgdb_state = DATA;
-                        data_process(a2, '\n', gui_data, &counter,
-                                command_list);
-                        data_process(a2, '\032', gui_data, &counter,
-                                command_list);
-                        data_process(a2, data[i], gui_data, &counter,
-                                command_list);
-                        break;
-                    case ANNOTATION:
-                        ibuf_addchar(sm->tgdb_buffer, data[i]);
-                        break;
-                    default:
-                        logger_write_pos(logger, __FILE__, __LINE__,
-                                "Bad state transition");
-                        break;
-                }               /* end switch */
-                break;
-        }                       /* end switch */
-    }                           /* end for */
+    while (i < size) {
+        /* Most of gdb's output is plain data, or the text of an annotation.
+         * Pass the whole run along at once instead of a char at a time. */
+        if (sm->tgdb_state == DATA || sm->tgdb_state == ANNOTATION) {
+            length = a2_run_length(data + i, size - i);
+
+            if (length > 0) {
+                if (sm->tgdb_state == DATA)
+                    data_process(a2, data + i, length, gui_data, &counter,
+                            command_list);
+                else
+                    ibuf_addn(sm->tgdb_buffer, data + i, length);
+
+                i += length;
+                continue;
+            }
+        }
+
+        a2_handle_char(a2, sm, data[i], gui_data, &counter, command_list);
+        ++i;
+    }
 
     gui_data[counter] = '\0';
     *gui_size = counter;
@@ -30,30 +30,85 @@
 #include <errno.h>
 #endif /* HAVE_ERRNO_H */
 
+#if HAVE_LIMITS_H
+#include <limits.h>
+#endif /* HAVE_LIMITS_H */
+
 #include "gdbmi_tgdb.h"
+#include "gdbmi_parser.h"
+#include "gdbmi_oc.h"
 #include "fork_util.h"
 #include "fs_util.h"
-#include "pseudo.h"
 #include "io.h"
 #include "tgdb_types.h"
 #include "queue.h"
 #include "sys_util.h"
 #include "ibuf.h"
+#include "std_hash.h"
 
 #define PATH_MAX 4096
-#define TTY_NAME_SIZE 64
+
+/**
+ * The most digits a token can have. A line that starts with more digits
+ * than this is not MI output.
+ */
+#define GDBMI_TOKEN_MAX 20
+
+/**
+ * Where the gdbmi context is in the line of output GDB is sending.
+ */
+enum gdbmi_line_state {
+    /** At the start of a line, reading the token if there is one. */
+    GDBMI_LINE_START,
+
+    /** Reading a result or async record, it is pushed to the parser. */
+    GDBMI_LINE_RECORD,
+
+    /** Reading a line that is not MI output, it is passed on as is. */
+    GDBMI_LINE_TEXT,
+
+    /** After the '~', '@' or '&' of a stream record, before its quote. */
+    GDBMI_LINE_STREAM_START,
+
+    /** Inside the cstring of a stream record. */
+    GDBMI_LINE_STREAM,
+
+    /** After a backslash inside the cstring of a stream record. */
+    GDBMI_LINE_STREAM_ESCAPE,
+
+    /** Reading the digits of an octal escape in a stream record. */
+    GDBMI_LINE_STREAM_OCTAL,
+
+    /** After the cstring of a stream record, until the newline. */
+    GDBMI_LINE_STREAM_END
+};
+
+/**
+ * A command sent to GDB that has not finished yet.
+ */
+struct gdbmi_command {
+    /** The token the command was sent with. */
+    unsigned int token;
+
+    /** What the command asks GDB for. */
+    enum gdbmi_commands command;
+
+    /** The file the command is about, or NULL. */
+    char *file;
+};
 
 /**
  * This is the main context for the gdbmi subsytem.
  */
 struct tgdb_gdbmi {
 
-    /** 
-	 * This is set when this context has initialized itself
+    /**
+	 * This is set when GDB has sent its first prompt. Input sent before
+	 * that is lost when GDB sets up its terminal.
 	 */
     int tgdb_initialized;
 
-    /** 
+    /**
 	 * writing to this will write to the stdin of the debugger
 	 */
     int debugger_stdin;
@@ -64,26 +119,16 @@ struct tgdb_gdbmi {
     int debugger_out;
 
     /**
-     * writing to this will write to the stdin of the inferior
-	 */
-    int inferior_stdin;
-
-    /**
-	 * Reading from reads the stdout/stderr of the inferior
+     * The pseudo terminal the inferior runs in.
 	 */
-    int inferior_out;
+    struct pty_pair *pty_pair;
 
     /**
-	 * Only kept around so it can be closed properly
-	 */
-    int inferior_slave_fd;
-
-    /** 
 	 * pid of child process.
 	 */
     pid_t debugger_pid;
 
-    /** 
+    /**
 	 * The config directory that this context can write too.
 	 */
     char config_dir[PATH_MAX];
@@ -94,102 +139,95 @@ struct tgdb_gdbmi {
     char gdbmi_gdb_init_file[PATH_MAX];
 
     /**
-	 * The name of the inferior tty.
-	 */
-    char inferior_tty_name[TTY_NAME_SIZE];
-
-    /** 
-	 * This is a list of all the commands generated since in the last call. 
+	 * This is a list of all the commands generated since in the last call.
 	 */
     struct tgdb_list *client_command_list;
 
     /**
-	 * This is the current output command from GDB.
+	 * The token GDB is sending at the start of a line.
 	 */
     struct ibuf *tgdb_cur_output_command;
+
+    /**
+	 * Where parse_io is in the line GDB is sending.
+	 */
+    enum gdbmi_line_state line_state;
+
+    /** The value of the octal escape being read. */
+    int octal_value;
+
+    /** The number of digits of the octal escape read so far. */
+    int octal_digits;
+
+    /**
+	 * The MI parser, the records are pushed to it as they arrive and
+	 * each one is processed as soon as its line is complete.
+	 */
+    gdbmi_parser_ptr parser;
+
+    /** The number of commands that finished in the current parse_io call. */
+    int commands_finished;
+
+    /** The output buffer of the current parse_io call. */
+    char *debugger_output;
+
+    /** The number of bytes written into debugger_output. */
+    size_t debugger_output_size;
+
+    /** The number of bytes debugger_output has room for. */
+    size_t debugger_output_capacity;
+
+    /**
+	 * Output that did not fit in debugger_output, it is written first on
+	 * the next parse_io call.
+	 */
+    struct ibuf *pending_output;
+
+    /** The responses for the front end of the current parse_io call. */
+    struct tgdb_list *cur_response_list;
+
+    /**
+	 * The commands sent to GDB that have not finished yet, oldest first.
+	 * GDB answers the commands in the order it reads them.
+	 */
+    struct gdbmi_command *pending;
+
+    /** The number of commands in pending. */
+    int pending_size;
+
+    /** The number of commands pending has room for. */
+    int pending_capacity;
+
+    /**
+	 * The breakpoints that were last sent to the front end.
+	 */
+    struct std_hashtable *breakpoints;
+
+    /** The source files that were last sent to the front end. */
+    struct tgdb_list *inferior_source_files;
+
+    /** The completions that were last sent to the front end. */
+    struct tgdb_list *tab_completions;
+
+    /** The prompt that was last sent to the front end. */
+    char *prompt;
+
+    /** The last console command, an empty line repeats some commands. */
+    char *last_console_command;
+
+    /** The absolute path of the position last sent to the front end. */
+    char *last_position_path;
+
+    /** The line of the position last sent to the front end. */
+    int last_position_line;
 };
 
-#if 0
-//static int gdbmi_set_inferior_tty ( void *ctx ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_TTY, 
-//              a2->inferior_tty_name, 
-//              0 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//
-//    return 0;
-//}
-//
-///* This is ok as static, all references will use the same data. */
-//static char *gdbmi_tgdb_commands[] = {
-//  "continue",
-//  "finish",
-//  "next",
-//  "run",
-//  "step",
-//  "up",
-//  "down"
-//};
-//
-//
-//static int close_inferior_connection ( void *ctx ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//
-//  if ( a2->inferior_stdin != -1 )
-//      cgdb_close ( a2->inferior_stdin );
-//
-//  a2->inferior_stdin = -1;
-//  a2->inferior_out   = -1;
-//  
-//  /* close tty connection */
-//  if ( a2->inferior_slave_fd != -1 )
-//      cgdb_close ( a2->inferior_slave_fd );
-//
-//  a2->inferior_slave_fd = -1;
-//
-//  if ( a2->inferior_tty_name[0] != '\0' )
-//      pty_release ( a2->inferior_tty_name );
-//
-//  return 0;
-//}
-//
-///* Here are the two functions that deal with getting tty information out
-// * of the annotate_two subsystem.
-// */
-//
-//int gdbmi_open_new_tty ( 
-//      void *ctx,
-//      int *inferior_stdin, 
-//      int *inferior_stdout ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//
-//    close_inferior_connection(a2);
-//
-//  /* Open up the tty communication */
-//  if ( util_new_tty(&(a2->inferior_stdin), &(a2->inferior_slave_fd), a2->inferior_tty_name) == -1){
-//      err_msg("%s:%d -> Could not open child tty", __FILE__, __LINE__);
-//      return -1;
-//  }
-//
-//  *inferior_stdin     = a2->inferior_stdin;
-//  *inferior_stdout    = a2->inferior_stdin;
-//
-//    a2_set_inferior_tty ( a2 );
-//    
-//    return 0;
-//}
-//
-//char *a2_get_tty_name ( void *ctx ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//  return a2->inferior_tty_name;
-//}
-#endif
+/* The console commands that GDB repeats when an empty line is entered. */
+static const char *const gdbmi_repeat_commands[] = {
+    "next", "n", "step", "s", "nexti", "ni", "stepi", "si",
+    "continue", "c", "finish", "fin", "until", "u", "up", "down",
+    NULL
+};
 
 /* initialize_gdbmi
  *
@@ -204,19 +242,42 @@ static struct tgdb_gdbmi *initialize_tgdb_gdbmi(void)
     gdbmi->debugger_stdin = -1;
     gdbmi->debugger_out = -1;
 
-    gdbmi->inferior_stdin = -1;
-    gdbmi->inferior_out = -1;
-    gdbmi->inferior_slave_fd = -1;
-    gdbmi->inferior_tty_name[0] = '\0';
+    gdbmi->pty_pair = NULL;
 
     /* null terminate */
     gdbmi->config_dir[0] = '\0';
     gdbmi->gdbmi_gdb_init_file[0] = '\0';
 
+    gdbmi->client_command_list = NULL;
+    gdbmi->tgdb_cur_output_command = NULL;
+    gdbmi->line_state = GDBMI_LINE_START;
+    gdbmi->octal_value = 0;
+    gdbmi->octal_digits = 0;
+    gdbmi->parser = NULL;
+    gdbmi->commands_finished = 0;
+
+    gdbmi->debugger_output = NULL;
+    gdbmi->debugger_output_size = 0;
+    gdbmi->debugger_output_capacity = 0;
+    gdbmi->pending_output = NULL;
+    gdbmi->cur_response_list = NULL;
+
+    gdbmi->pending = NULL;
+    gdbmi->pending_size = 0;
+    gdbmi->pending_capacity = 0;
+
+    gdbmi->breakpoints = NULL;
+    gdbmi->inferior_source_files = NULL;
+    gdbmi->tab_completions = NULL;
+    gdbmi->prompt = NULL;
+    gdbmi->last_console_command = NULL;
+    gdbmi->last_position_path = NULL;
+    gdbmi->last_position_line = 0;
+
     return gdbmi;
 }
 
-/* tgdb_setup_config_file: 
+/* tgdb_setup_config_file:
  * -----------------------
  *  Creates a config file for the user.
  *
@@ -234,7 +295,7 @@ static int tgdb_setup_config_file(struct tgdb_gdbmi *gdbmi, const char *dir)
     fs_util_get_path(dir, "gdbmi_gdb_init", gdbmi->gdbmi_gdb_init_file);
 
     if ((fp = fopen(gdbmi->gdbmi_gdb_init_file, "w"))) {
-        fprintf(fp, "set height 0\n" "set prompt (tgdbmi) \n");
+        fprintf(fp, "set height 0\n");
         fclose(fp);
     } else {
         logger_write_pos(logger, __FILE__, __LINE__, "fopen error '%s'",
@@ -245,6 +306,721 @@ static int tgdb_setup_config_file(struct tgdb_gdbmi *gdbmi, const char *dir)
     return 1;
 }
 
+/* gdbmi_escape_char:
+ * ------------------
+ *
+ * Returns the character a C escape sequence stands for.
+ *
+ * c - The character after the backslash, it is not an octal digit.
+ */
+static char gdbmi_escape_char(char c)
+{
+    switch (c) {
+        case 'n':
+            return '\n';
+        case 't':
+            return '\t';
+        case 'r':
+            return '\r';
+        case 'b':
+            return '\b';
+        case 'f':
+            return '\f';
+        case 'v':
+            return '\v';
+        case 'a':
+            return '\a';
+        case 'e':
+            return '\033';
+        default:
+            return c;
+    }
+}
+
+/* gdbmi_cstring_dup:
+ * ------------------
+ *
+ * Returns the text of a cstring from the MI parse tree, without its quotes
+ * and with its escape sequences replaced. The caller frees it.
+ */
+static char *gdbmi_cstring_dup(const char *cstring)
+{
+    struct ibuf *buf = ibuf_init();
+    const char *ptr = cstring;
+    char *text;
+    int value, digits;
+
+    if (*ptr == '"')
+        ++ptr;
+
+    while (*ptr && *ptr != '"') {
+        if (*ptr != '\\' || !ptr[1]) {
+            ibuf_addchar(buf, *ptr++);
+        } else if (ptr[1] >= '0' && ptr[1] <= '7') {
+            ++ptr;
+            for (value = 0, digits = 0;
+                    digits < 3 && *ptr >= '0' && *ptr <= '7'; ++digits)
+                value = value * 8 + (*ptr++ - '0');
+            ibuf_addchar(buf, (char) value);
+        } else {
+            ibuf_addchar(buf, gdbmi_escape_char(ptr[1]));
+            ptr += 2;
+        }
+    }
+
+    text = cgdb_strdup(ibuf_get(buf));
+    ibuf_free(buf);
+
+    return text;
+}
+
+/* gdbmi_add_cstring:
+ * ------------------
+ *
+ * Adds TEXT to BUF as a cstring GDB can read, with quotes around it.
+ */
+static void gdbmi_add_cstring(struct ibuf *buf, const char *text)
+{
+    ibuf_addchar(buf, '"');
+
+    for (; *text; ++text) {
+        if (*text == '"' || *text == '\\')
+            ibuf_addchar(buf, '\\');
+        ibuf_addchar(buf, *text);
+    }
+
+    ibuf_addchar(buf, '"');
+}
+
+static int gdbmi_free_char_star(void *item)
+{
+    free(item);
+
+    return 0;
+}
+
+/* The value of the result KEY in the list RESULT, or NULL */
+static gdbmi_value_ptr gdbmi_find_value(gdbmi_result_ptr result,
+        enum gdbmi_key key)
+{
+    result = gdbmi_result_find(result, key);
+
+    return result ? result->value : NULL;
+}
+
+/* The text of the cstring VALUE, or NULL. Free it. */
+static char *gdbmi_value_cstring(gdbmi_value_ptr value)
+{
+    if (value && value->value_choice == GDBMI_CSTRING)
+        return gdbmi_cstring_dup(value->option.cstring);
+
+    return NULL;
+}
+
+/* The text of the cstring KEY in RESULT, or NULL. Free it. */
+static char *gdbmi_find_cstring(gdbmi_result_ptr result, enum gdbmi_key key)
+{
+    return gdbmi_value_cstring(gdbmi_find_value(result, key));
+}
+
+/* The tuple KEY in RESULT, or NULL */
+static gdbmi_tuple_ptr gdbmi_find_tuple(gdbmi_result_ptr result,
+        enum gdbmi_key key)
+{
+    gdbmi_value_ptr value = gdbmi_find_value(result, key);
+
+    if (value && value->value_choice == GDBMI_TUPLE)
+        return value->option.tuple;
+
+    return NULL;
+}
+
+/* gdbmi_write_output:
+ * -------------------
+ *
+ * Writes output the user should see. The output buffer only has room for
+ * as many bytes as the input of the parse_io call. The output is never
+ * longer than the input it came from, but the input can be from earlier
+ * calls, like the digits at the start of a line. What does not fit is
+ * written on the next call.
+ */
+static void gdbmi_write_output(struct tgdb_gdbmi *gdbmi,
+        const char *data, size_t size)
+{
+    size_t room =
+            gdbmi->debugger_output_capacity - gdbmi->debugger_output_size;
+
+    if (ibuf_length(gdbmi->pending_output) > 0 || size > room) {
+        ibuf_addn(gdbmi->pending_output, data, size);
+        return;
+    }
+
+    memcpy(gdbmi->debugger_output + gdbmi->debugger_output_size, data, size);
+    gdbmi->debugger_output_size += size;
+}
+
+/* Writes the output that did not fit in the last parse_io call */
+static void gdbmi_write_pending_output(struct tgdb_gdbmi *gdbmi)
+{
+    size_t size = ibuf_length(gdbmi->pending_output);
+    char *rest;
+
+    if (size > gdbmi->debugger_output_capacity)
+        size = gdbmi->debugger_output_capacity;
+
+    memcpy(gdbmi->debugger_output, ibuf_get(gdbmi->pending_output), size);
+    gdbmi->debugger_output_size = size;
+
+    rest = cgdb_strdup(ibuf_get(gdbmi->pending_output) + size);
+    ibuf_clear(gdbmi->pending_output);
+    ibuf_add(gdbmi->pending_output, rest);
+    free(rest);
+}
+
+static void gdbmi_write_char(struct tgdb_gdbmi *gdbmi, char c)
+{
+    gdbmi_write_output(gdbmi, &c, 1);
+}
+
+static void gdbmi_append_response(struct tgdb_gdbmi *gdbmi,
+        struct tgdb_response *response)
+{
+    if (gdbmi->cur_response_list)
+        tgdb_types_append_command(gdbmi->cur_response_list, response);
+    else
+        tgdb_types_free_command(response);
+}
+
+/* gdbmi_issue_command:
+ * --------------------
+ *
+ * Queues a command for GDB. It is sent with its token once tgdb-base
+ * delivers it, see gdbmi_prepare_for_command.
+ *
+ * command    - What the command asks GDB for.
+ * mi_command - The MI command, ending in a newline.
+ * file       - The file the command is about, or NULL.
+ */
+static int gdbmi_issue_command(struct tgdb_gdbmi *gdbmi,
+        enum gdbmi_commands command, const char *mi_command, const char *file)
+{
+    struct gdbmi_command *data = (struct gdbmi_command *)
+            cgdb_malloc(sizeof (struct gdbmi_command));
+
+    data->token = 0;
+    data->command = command;
+    data->file = file ? cgdb_strdup(file) : NULL;
+
+    tgdb_list_append(gdbmi->client_command_list,
+            tgdb_command_create(mi_command, TGDB_COMMAND_TGDB_CLIENT, data));
+
+    return 0;
+}
+
+/**
+ * Marks the command with the token as finished.
+ *
+ * GDB answers the commands in order, so the commands sent before it that
+ * have not been answered will never be, and they are finished too.
+ *
+ * \param token
+ * The token of the result record GDB sent.
+ *
+ * \param command
+ * If not NULL, the finished command is copied here and the caller frees its
+ * file. It is left alone if no command finished.
+ *
+ * \return
+ * The number of commands that finished. This is 0 when the token does not
+ * belong to a pending command.
+ */
+static int gdbmi_finish_token(struct tgdb_gdbmi *gdbmi, unsigned int token,
+        struct gdbmi_command *command)
+{
+    int i, j;
+
+    for (i = 0; i < gdbmi->pending_size; ++i) {
+        if (gdbmi->pending[i].token == token) {
+            for (j = 0; j < i; ++j)
+                free(gdbmi->pending[j].file);
+
+            if (command)
+                *command = gdbmi->pending[i];
+            else
+                free(gdbmi->pending[i].file);
+
+            ++i;
+            gdbmi->pending_size -= i;
+            memmove(gdbmi->pending, gdbmi->pending + i,
+                    sizeof (struct gdbmi_command) * gdbmi->pending_size);
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+/* gdbmi_send_file_position:
+ * -------------------------
+ *
+ * Tells the front end where GDB is. Unless FORCE is set, nothing is sent if
+ * it is where the front end was told last.
+ */
+static void gdbmi_send_file_position(struct tgdb_gdbmi *gdbmi,
+        const char *fullname, const char *file, int line, int force)
+{
+    struct tgdb_file_position *tfp;
+    struct tgdb_response *response;
+
+    if (!force && gdbmi->last_position_path &&
+            strcmp(gdbmi->last_position_path, fullname) == 0 &&
+            gdbmi->last_position_line == line)
+        return;
+
+    free(gdbmi->last_position_path);
+    gdbmi->last_position_path = cgdb_strdup(fullname);
+    gdbmi->last_position_line = line;
+
+    tfp = (struct tgdb_file_position *)
+            cgdb_malloc(sizeof (struct tgdb_file_position));
+    tfp->absolute_path = cgdb_strdup(fullname);
+    tfp->relative_path = cgdb_strdup(file ? file : fullname);
+    tfp->line_number = line;
+
+    response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+    response->header = TGDB_UPDATE_FILE_POSITION;
+    response->choice.update_file_position.file_position = tfp;
+    gdbmi_append_response(gdbmi, response);
+}
+
+/* Tells the front end about the position in a frame tuple, if it has one */
+static void gdbmi_send_frame(struct tgdb_gdbmi *gdbmi,
+        gdbmi_tuple_ptr frame, int force)
+{
+    gdbmi_value_ptr values[GDBMI_FRAME_LAST];
+    char *fullname, *file, *line;
+
+    if (gdbmi_get_frame_fields(frame, values) == -1)
+        return;
+
+    fullname = gdbmi_value_cstring(values[GDBMI_FRAME_FULLNAME]);
+    file = gdbmi_value_cstring(values[GDBMI_FRAME_FILE]);
+    line = gdbmi_value_cstring(values[GDBMI_FRAME_LINE]);
+
+    if (fullname && line)
+        gdbmi_send_file_position(gdbmi, fullname, file, atoi(line), force);
+
+    free(fullname);
+    free(file);
+    free(line);
+}
+
+/* Tells the front end that the current position could not be found */
+static void gdbmi_send_source_denied(struct tgdb_gdbmi *gdbmi,
+        const char *file)
+{
+    struct tgdb_source_file *rejected = (struct tgdb_source_file *)
+            cgdb_malloc(sizeof (struct tgdb_source_file));
+    struct tgdb_response *response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+
+    rejected->absolute_path = file ? cgdb_strdup(file) : NULL;
+
+    response->header = TGDB_ABSOLUTE_SOURCE_DENIED;
+    response->choice.absolute_source_denied.source_file = rejected;
+    gdbmi_append_response(gdbmi, response);
+}
+
+static void gdbmi_send_sources_denied(struct tgdb_gdbmi *gdbmi)
+{
+    struct tgdb_response *response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+
+    response->header = TGDB_SOURCES_DENIED;
+    gdbmi_append_response(gdbmi, response);
+}
+
+static void gdbmi_send_completions(struct tgdb_gdbmi *gdbmi)
+{
+    struct tgdb_response *response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+
+    response->header = TGDB_UPDATE_COMPLETIONS;
+    response->choice.update_completions.completion_list =
+            gdbmi->tab_completions;
+    gdbmi_append_response(gdbmi, response);
+}
+
+/* Tells the front end the inferior exited, with the status in RESULT */
+static void gdbmi_send_inferior_exited(struct tgdb_gdbmi *gdbmi,
+        gdbmi_result_ptr result)
+{
+    char *exit_code = gdbmi_find_cstring(result, GDBMI_KEY_EXIT_CODE);
+    int *status = (int *) cgdb_malloc(sizeof (int));
+    struct tgdb_response *response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+
+    /* GDB prints the exit code in octal */
+    *status = exit_code ? (int) strtol(exit_code, NULL, 8) : 0;
+    free(exit_code);
+
+    response->header = TGDB_INFERIOR_EXITED;
+    response->choice.inferior_exited.exit_status = status;
+    gdbmi_append_response(gdbmi, response);
+}
+
+/* gdbmi_process_async_record:
+ * ---------------------------
+ *
+ * GDB sends an async record when the inferior stops, and when the user
+ * selects another frame or thread. A record with a frame moves the
+ * front end to its position.
+ */
+static void gdbmi_process_async_record(struct tgdb_gdbmi *gdbmi,
+        gdbmi_async_record_ptr record)
+{
+    gdbmi_tuple_ptr frame;
+    char *reason;
+
+    if (record->async_record == GDBMI_EXEC &&
+            record->async_class == GDBMI_STOPPED) {
+        reason = gdbmi_find_cstring(record->result, GDBMI_KEY_REASON);
+        if (reason && (strcmp(reason, "exited") == 0 ||
+                        strcmp(reason, "exited-normally") == 0)) {
+            gdbmi_send_inferior_exited(gdbmi, record->result);
+            free(reason);
+            return;
+        }
+        free(reason);
+    }
+
+    frame = gdbmi_find_tuple(record->result, GDBMI_KEY_FRAME);
+    if (frame)
+        gdbmi_send_frame(gdbmi, frame, 1);
+}
+
+/* gdbmi_get_oc:
+ * -------------
+ *
+ * Lets gdbmi_oc interpret the result of the command MI_COMMAND.
+ * Returns the output command, or NULL on error.
+ */
+static gdbmi_oc_ptr gdbmi_get_oc(gdbmi_output_ptr output,
+        const char *mi_command)
+{
+    gdbmi_oc_cstring_ll_ptr input = create_gdbmi_cstring_ll();
+    gdbmi_output_ptr next = output->next;
+    gdbmi_oc_ptr oc = NULL;
+
+    input->cstring = cgdb_strdup(mi_command);
+
+    output->next = NULL;
+    if (gdbmi_get_output_commands(output, input, &oc) == -1) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "gdbmi_get_output_commands error for %s", mi_command);
+        destroy_gdbmi_oc(oc);
+        oc = NULL;
+    }
+    output->next = next;
+
+    destroy_gdbmi_cstring_ll(input);
+
+    return oc;
+}
+
+static void gdbmi_process_break_list(struct tgdb_gdbmi *gdbmi,
+        gdbmi_output_ptr output)
+{
+    gdbmi_oc_ptr oc = gdbmi_get_oc(output, "-break-list");
+    gdbmi_oc_breakpoint_ptr bp;
+    struct tgdb_list *listed, *delta;
+    struct tgdb_breakpoint *tb;
+    struct tgdb_response *response;
+
+    if (!oc)
+        return;
+
+    listed = tgdb_list_init();
+    for (bp = oc->input_commands.break_list.breakpoint_ptr; bp; bp = bp->next) {
+        if (bp->type != GDBMI_BREAKPOINT || !bp->fullname)
+            continue;
+
+        tb = (struct tgdb_breakpoint *)
+                cgdb_malloc(sizeof (struct tgdb_breakpoint));
+        tb->file = cgdb_strdup(bp->fullname);
+        tb->funcname = bp->func ? cgdb_strdup(bp->func) : NULL;
+        tb->line = bp->line;
+        tb->enabled = bp->enabled;
+        tb->change = TGDB_BREAKPOINT_ADDED;
+        tgdb_list_append(listed, tb);
+    }
+    destroy_gdbmi_oc(oc);
+
+    delta = tgdb_types_breakpoint_delta(&gdbmi->breakpoints, listed);
+    tgdb_list_destroy(listed);
+
+    /* Only the changes are sent to the gui, if there are any */
+    if (tgdb_list_size(delta) == 0) {
+        tgdb_list_destroy(delta);
+        return;
+    }
+
+    response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+    response->header = TGDB_UPDATE_BREAKPOINTS;
+    response->choice.update_breakpoints.breakpoint_list = delta;
+    gdbmi_append_response(gdbmi, response);
+}
+
+static void gdbmi_process_current_location(struct tgdb_gdbmi *gdbmi,
+        gdbmi_output_ptr output)
+{
+    gdbmi_oc_ptr oc = gdbmi_get_oc(output, "-file-list-exec-source-file");
+
+    if (oc && oc->input_commands.file_list_exec_source_file.fullname)
+        gdbmi_send_file_position(gdbmi,
+                oc->input_commands.file_list_exec_source_file.fullname,
+                oc->input_commands.file_list_exec_source_file.file,
+                oc->input_commands.file_list_exec_source_file.line, 1);
+    else
+        gdbmi_send_source_denied(gdbmi, NULL);
+
+    destroy_gdbmi_oc(oc);
+}
+
+static void gdbmi_process_inferior_sources(struct tgdb_gdbmi *gdbmi,
+        gdbmi_output_ptr output)
+{
+    gdbmi_oc_ptr oc = gdbmi_get_oc(output, "-file-list-exec-source-files");
+    gdbmi_oc_file_path_info_ptr info;
+    struct tgdb_response *response;
+    const char *path;
+
+    tgdb_list_free(gdbmi->inferior_source_files, gdbmi_free_char_star);
+    tgdb_list_clear(gdbmi->inferior_source_files);
+
+    info = oc ? oc->input_commands.file_list_exec_source_files.
+            file_name_pair : NULL;
+    for (; info; info = info->next) {
+        path = info->fullname ? info->fullname : info->file;
+        if (path)
+            tgdb_list_append(gdbmi->inferior_source_files, cgdb_strdup(path));
+    }
+    destroy_gdbmi_oc(oc);
+
+    /* If the inferior program was not compiled with debug, then no sources
+     * will be available. */
+    if (tgdb_list_size(gdbmi->inferior_source_files) == 0) {
+        gdbmi_send_sources_denied(gdbmi);
+        return;
+    }
+
+    response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+    response->header = TGDB_UPDATE_SOURCE_FILES;
+    response->choice.update_source_files.source_files =
+            gdbmi->inferior_source_files;
+    gdbmi_append_response(gdbmi, response);
+}
+
+static void gdbmi_process_filename_pair(struct tgdb_gdbmi *gdbmi,
+        gdbmi_output_ptr output, const char *file)
+{
+    gdbmi_oc_ptr oc = gdbmi_get_oc(output, "-file-list-exec-source-files");
+    gdbmi_oc_file_path_info_ptr info;
+    struct tgdb_response *response;
+
+    info = oc ? oc->input_commands.file_list_exec_source_files.
+            file_name_pair : NULL;
+    for (; info && file; info = info->next) {
+        if (!info->fullname)
+            continue;
+
+        if (strcmp(info->fullname, file) == 0 ||
+                (info->file && strcmp(info->file, file) == 0))
+            break;
+    }
+
+    if (info && file) {
+        response = (struct tgdb_response *)
+                cgdb_malloc(sizeof (struct tgdb_response));
+        response->header = TGDB_FILENAME_PAIR;
+        response->choice.filename_pair.absolute_path =
+                cgdb_strdup(info->fullname);
+        response->choice.filename_pair.relative_path =
+                cgdb_strdup(info->file ? info->file : info->fullname);
+        gdbmi_append_response(gdbmi, response);
+    } else
+        gdbmi_send_source_denied(gdbmi, file);
+
+    destroy_gdbmi_oc(oc);
+}
+
+static void gdbmi_process_completions(struct tgdb_gdbmi *gdbmi,
+        gdbmi_result_ptr result)
+{
+    gdbmi_value_ptr matches = gdbmi_find_value(result, GDBMI_KEY_MATCHES);
+    gdbmi_value_ptr value = NULL;
+
+    tgdb_list_free(gdbmi->tab_completions, gdbmi_free_char_star);
+    tgdb_list_clear(gdbmi->tab_completions);
+
+    if (matches && matches->value_choice == GDBMI_LIST &&
+            matches->option.list &&
+            matches->option.list->list_choice == GDBMI_VALUE)
+        value = matches->option.list->option.value;
+
+    for (; value; value = value->next)
+        if (value->value_choice == GDBMI_CSTRING)
+            tgdb_list_append(gdbmi->tab_completions,
+                    gdbmi_cstring_dup(value->option.cstring));
+
+    gdbmi_send_completions(gdbmi);
+}
+
+static void gdbmi_process_prompt_value(struct tgdb_gdbmi *gdbmi,
+        gdbmi_result_ptr result)
+{
+    char *prompt = gdbmi_find_cstring(result, GDBMI_KEY_VALUE);
+    struct tgdb_response *response;
+
+    if (!prompt || (gdbmi->prompt && strcmp(gdbmi->prompt, prompt) == 0)) {
+        free(prompt);
+        return;
+    }
+
+    free(gdbmi->prompt);
+    gdbmi->prompt = prompt;
+
+    response = (struct tgdb_response *)
+            cgdb_malloc(sizeof (struct tgdb_response));
+    response->header = TGDB_UPDATE_CONSOLE_PROMPT_VALUE;
+    response->choice.update_console_prompt_value.prompt_value =
+            cgdb_strdup(prompt);
+    gdbmi_append_response(gdbmi, response);
+}
+
+/* gdbmi_process_result_record:
+ * ----------------------------
+ *
+ * Finishes the command the result record answers and tells the front end
+ * what it found out.
+ *
+ * Returns the number of commands that finished.
+ */
+static int gdbmi_process_result_record(struct tgdb_gdbmi *gdbmi,
+        gdbmi_output_ptr output)
+{
+    gdbmi_result_record_ptr record = output->result_record;
+    struct gdbmi_command command;
+    int finished, done;
+
+    if (record->token < 0)
+        return 0;
+
+    finished = gdbmi_finish_token(gdbmi, (unsigned int) record->token,
+            &command);
+    if (finished == 0)
+        return 0;
+
+    done = record->result_class == GDBMI_DONE;
+
+    switch (command.command) {
+        case GDBMI_COMMAND_CONSOLE:
+            /* GDB prints the errors of console commands on the log stream */
+            break;
+        case GDBMI_COMMAND_BREAK_LIST:
+            if (done)
+                gdbmi_process_break_list(gdbmi, output);
+            break;
+        case GDBMI_COMMAND_STACK_INFO_FRAME:
+            if (done)
+                gdbmi_send_frame(gdbmi,
+                        gdbmi_find_tuple(record->result, GDBMI_KEY_FRAME), 0);
+            break;
+        case GDBMI_COMMAND_CURRENT_LOCATION:
+            if (done)
+                gdbmi_process_current_location(gdbmi, output);
+            else
+                gdbmi_send_source_denied(gdbmi, NULL);
+            break;
+        case GDBMI_COMMAND_INFERIOR_SOURCES:
+            if (done)
+                gdbmi_process_inferior_sources(gdbmi, output);
+            else
+                gdbmi_send_sources_denied(gdbmi);
+            break;
+        case GDBMI_COMMAND_FILENAME_PAIR:
+            if (done)
+                gdbmi_process_filename_pair(gdbmi, output, command.file);
+            else
+                gdbmi_send_source_denied(gdbmi, command.file);
+            break;
+        case GDBMI_COMMAND_COMPLETE:
+            gdbmi_process_completions(gdbmi, done ? record->result : NULL);
+            break;
+        case GDBMI_COMMAND_INFERIOR_TTY:
+            break;
+        case GDBMI_COMMAND_SHOW_PROMPT:
+            if (done)
+                gdbmi_process_prompt_value(gdbmi, record->result);
+            break;
+    }
+
+    free(command.file);
+
+    return finished;
+}
+
+/* gdbmi_process_line:
+ * -------------------
+ *
+ * The parser callback, it gets each result or async record line and the
+ * prompt as soon as GDB sent the newline.
+ */
+static void gdbmi_process_line(void *context,
+        const char *line, size_t size, gdbmi_output_ptr output)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) context;
+    const char *ptr, *end = line + size;
+    unsigned int token = 0;
+    gdbmi_oob_record_ptr oob;
+
+    if (!output) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "could not parse MI output '%.*s'", (int) size, line);
+
+        /* Finish the command by its token, so that TGDB keeps running.
+         * A line that only looked like a record is shown as is. */
+        for (ptr = line; ptr < end && *ptr >= '0' && *ptr <= '9'; ++ptr)
+            token = token * 10 + (*ptr - '0');
+
+        if (ptr < end && *ptr == '^') {
+            if (ptr != line)
+                gdbmi->commands_finished +=
+                        gdbmi_finish_token(gdbmi, token, NULL);
+        } else if (ptr < end && *ptr == '(') {
+            gdbmi_write_output(gdbmi, line, size);
+            gdbmi_write_char(gdbmi, '\n');
+        }
+        return;
+    }
+
+    if (!output->oob_record && !output->result_record)
+        gdbmi->tgdb_initialized = 1;
+
+    for (oob = output->oob_record; oob; oob = oob->next)
+        if (oob->record == GDBMI_ASYNC)
+            gdbmi_process_async_record(gdbmi, oob->option.async_record);
+
+    if (output->result_record)
+        gdbmi->commands_finished +=
+                gdbmi_process_result_record(gdbmi, output);
+
+    destroy_gdbmi_output(output);
+}
+
 void *gdbmi_create_context(const char *debugger,
         int argc, char **argv, const char *config_dir, struct logger *logger)
 {
@@ -273,6 +1049,12 @@ void *gdbmi_create_context(const char *debugger,
         return NULL;
 
     gdbmi->tgdb_cur_output_command = ibuf_init();
+    gdbmi->pending_output = ibuf_init();
+    gdbmi->parser = gdbmi_parser_create();
+    gdbmi_parser_set_callback(gdbmi->parser, gdbmi_process_line, gdbmi);
+    gdbmi->breakpoints = tgdb_types_breakpoint_table_create();
+    gdbmi->inferior_source_files = tgdb_list_init();
+    gdbmi->tab_completions = tgdb_list_init();
 
     return gdbmi;
 }
@@ -288,19 +1070,18 @@ int gdbmi_initialize(void *ctx,
     *debugger_stdin = gdbmi->debugger_stdin;
     *debugger_stdout = gdbmi->debugger_out;
 
-    gdbmi->tgdb_initialized = 1;
-
-#if 0
-    /* Need to set the prompt via a tgdb_response */
-    struct tgdb_client_command *client_command = NULL;
+    gdbmi_open_new_tty(gdbmi, inferior_stdin, inferior_stdout);
 
-    client_command = tgdb_client_command_create("(tgdbmi) ",
-            TGDB_CLIENT_COMMAND_TGDB_BASE,
-            TGDB_CLIENT_COMMAND_DISPLAY_NOTHING,
-            TGDB_CLIENT_COMMAND_ACTION_CONSOLE_SET_PROMPT, NULL);
+    /* gdb may already have some breakpoints when it starts. This could happen
+     * if the user puts breakpoints in there .gdbinit.
+     * This makes sure that TGDB asks for the breakpoints on start up.
+     */
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_BREAK_LIST, "-break-list\n",
+            NULL);
 
-    tgdb_list_append(gdbmi->client_command_list, client_command);
-#endif
+    /* The front end shows the console prompt, which the init files can set */
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_SHOW_PROMPT,
+            "-gdb-show prompt\n", NULL);
 
     return 0;
 }
@@ -308,133 +1089,89 @@ int gdbmi_initialize(void *ctx,
 int gdbmi_shutdown(void *ctx)
 {
     struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+    int i;
 
     cgdb_close(gdbmi->debugger_stdin);
+    gdbmi->debugger_stdin = -1;
+
+    if (gdbmi->pty_pair) {
+        pty_pair_destroy(gdbmi->pty_pair);
+        gdbmi->pty_pair = NULL;
+    }
 
     ibuf_free(gdbmi->tgdb_cur_output_command);
     gdbmi->tgdb_cur_output_command = NULL;
 
-    return 0;
-}
-
-#if 0
-/* TODO: Implement error messages. */
-//int a2_err_msg ( void *ctx ) {
-//  return -1;
-//}
-#endif
+    ibuf_free(gdbmi->pending_output);
+    gdbmi->pending_output = NULL;
 
-int gdbmi_is_client_ready(void *ctx)
-{
-    return 1;
-}
-
-enum newlinestyle {
-    GDBMI_NL,
-    GDBMI_CR_NL,
-    GDBMI_CR
-};
-
-/**
- * Checks to see if ibuf ends with the string ending.
- *
- * \param ibuf
- * The string to check the ending of
- *
- * \param style
- * represents what kind of newline is associated with this command.
- *
- * \param success
- * 1 if ibuf ends with ending, otherwise 0
- *
- * \return
- * 0 on success, or -1 on error
- */
-static int ends_with_gdbmi_prompt(struct ibuf *ibuf, enum newlinestyle style,
-        int *success)
-{
-    char *ibuf_string;
-    int length;
-
-    if (!ibuf)
-        return -1;
-
-    if (!success)
-        return -1;
+    if (gdbmi->parser) {
+        gdbmi_parser_destroy(gdbmi->parser);
+        gdbmi->parser = NULL;
+    }
 
-    *success = 0;
+    for (i = 0; i < gdbmi->pending_size; ++i)
+        free(gdbmi->pending[i].file);
+    free(gdbmi->pending);
+    gdbmi->pending = NULL;
+    gdbmi->pending_size = 0;
 
-    length = ibuf_length(ibuf);
+    if (gdbmi->breakpoints) {
+        std_hash_table_destroy(gdbmi->breakpoints);
+        gdbmi->breakpoints = NULL;
+    }
 
-    /* If the string is not long enough, don't try */
-    if (style == GDBMI_CR_NL && length < 8)
-        return 0;
-    else if (length < 7)
-        return 0;
+    if (gdbmi->inferior_source_files) {
+        tgdb_list_free(gdbmi->inferior_source_files,
+                gdbmi_free_char_star);
+        tgdb_list_destroy(gdbmi->inferior_source_files);
+        gdbmi->inferior_source_files = NULL;
+    }
 
-    ibuf_string = ibuf_get(ibuf);
+    if (gdbmi->tab_completions) {
+        tgdb_list_free(gdbmi->tab_completions, gdbmi_free_char_star);
+        tgdb_list_destroy(gdbmi->tab_completions);
+        gdbmi->tab_completions = NULL;
+    }
 
-    /* Match the char's backwards, go to the end */
-    ibuf_string = ibuf_string + length - 1;
+    free(gdbmi->prompt);
+    gdbmi->prompt = NULL;
 
-    if (style == GDBMI_CR_NL)
-        ibuf_string -= 2;
-    else
-        ibuf_string--;
+    free(gdbmi->last_console_command);
+    gdbmi->last_console_command = NULL;
 
-    /* Check for the prompt */
-    if (*(ibuf_string) == ' ' &&
-            *(ibuf_string - 1) == ')' &&
-            *(ibuf_string - 2) == 'b' &&
-            *(ibuf_string - 3) == 'd' &&
-            *(ibuf_string - 4) == 'g' && *(ibuf_string - 5) == '(')
-        *success = 1;
+    free(gdbmi->last_position_path);
+    gdbmi->last_position_path = NULL;
 
-    /* Look at newline */
     return 0;
-
 }
 
-/**
- * Determine's what kind of newline the string ends in.
- *
- */
-static int gdbmi_get_newline_style(struct ibuf *ibuf, enum newlinestyle *style)
+int gdbmi_err_msg(void *ctx)
 {
-    char *buf;
-    int length;
-
-    if (!ibuf)
-        return -1;
+    return -1;
+}
 
-    if (!style)
-        return -1;
+int gdbmi_is_client_ready(void *ctx)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
 
-    buf = ibuf_get(ibuf);
-    length = ibuf_length(ibuf);
-
-    /* Check to see if an entire command has been reached. */
-    if (buf[length - 1] == '\r') {
-        *style = GDBMI_CR;
-    } else if (buf[length - 1] == '\n') {
-        if (length > 1 && buf[length - 2] == '\r')
-            *style = GDBMI_CR_NL;
-        else
-            *style = GDBMI_NL;
-    }
+    return gdbmi->tgdb_initialized;
+}
 
-    return 0;
+int gdbmi_get_pipeline_depth(void *ctx)
+{
+    /* Every command carries a token, and GDB answers them in order. */
+    return INT_MAX;
 }
 
-/* 
- * 1. Align the 'input' data into null-terminated strings that
- *    end in a newline.
- * 2. Check to see if a command has been fully recieved.
- *    2a. If it has, go to step 3
- *    2b. If it hasn't, return from the function
- * 3. parse the command.
- * 4. traverse the parse tree to populate the tgdb_list with
- *    commands the user/front end is looking for.
+/*
+ * 1. Pass the console output and anything that is not MI straight through.
+ *    The cstrings of the stream records are decoded as they arrive.
+ * 2. Push the result and async records to the parser as they arrive.
+ *    Each record is parsed as soon as its newline arrives.
+ * 3. traverse the parse tree to populate the tgdb_list with
+ *    commands the user/front end is looking for. A result record
+ *    finishes the command with its token.
  */
 int gdbmi_parse_io(void *ctx,
         const char *input_data, const size_t input_data_size,
@@ -443,41 +1180,137 @@ int gdbmi_parse_io(void *ctx,
         struct tgdb_list *list)
 {
     struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
-    int found_command = 0;
-    enum newlinestyle style = GDBMI_NL;
-
-    ibuf_add(gdbmi->tgdb_cur_output_command, input_data);
-
-    if (input_data[input_data_size - 1] == '\r' ||
-            input_data[input_data_size - 1] == '\n') {
-        if (gdbmi_get_newline_style(gdbmi->tgdb_cur_output_command,
-                        &style) == -1) {
-            logger_write_pos(logger, __FILE__, __LINE__,
-                    "gdbmi_get_newline_stlye error");
-            return -1;
-        }
-
-        if (ends_with_gdbmi_prompt(gdbmi->tgdb_cur_output_command, style,
-                        &found_command) == -1) {
-            logger_write_pos(logger, __FILE__, __LINE__,
-                    "ends_with_gdbmi_prompt error");
-            return -1;
+    struct ibuf *line = gdbmi->tgdb_cur_output_command;
+    const char *data = input_data, *end = input_data + input_data_size;
+    const char *ptr;
+    char c;
+
+    gdbmi->debugger_output = debugger_output;
+    gdbmi->debugger_output_size = 0;
+    gdbmi->debugger_output_capacity = input_data_size;
+    gdbmi->cur_response_list = list;
+    gdbmi->commands_finished = 0;
+
+    if (ibuf_length(gdbmi->pending_output) > 0)
+        gdbmi_write_pending_output(gdbmi);
+
+    while (data < end) {
+        c = *data;
+
+        switch (gdbmi->line_state) {
+            case GDBMI_LINE_START:
+                ++data;
+                if (c >= '0' && c <= '9' &&
+                        ibuf_length(line) < GDBMI_TOKEN_MAX) {
+                    ibuf_addchar(line, c);
+                } else if (c == '~' || c == '@' || c == '&') {
+                    ibuf_clear(line);
+                    gdbmi->line_state = GDBMI_LINE_STREAM_START;
+                } else if (c == '^' || c == '*' || c == '+' || c == '=' ||
+                        c == '(') {
+                    ibuf_addchar(line, c);
+                    gdbmi_parser_push(gdbmi->parser, ibuf_get(line),
+                            ibuf_length(line));
+                    ibuf_clear(line);
+                    gdbmi->line_state = GDBMI_LINE_RECORD;
+                } else if (c == '\r') {
+                    /* The newline comes next */
+                } else {
+                    gdbmi_write_output(gdbmi, ibuf_get(line),
+                            ibuf_length(line));
+                    ibuf_clear(line);
+                    gdbmi_write_char(gdbmi, c);
+                    if (c != '\n')
+                        gdbmi->line_state = GDBMI_LINE_TEXT;
+                }
+                break;
+            case GDBMI_LINE_RECORD:
+                ptr = memchr(data, '\n', end - data);
+                ptr = ptr ? ptr + 1 : end;
+                gdbmi_parser_push(gdbmi->parser, data, ptr - data);
+                if (ptr[-1] == '\n')
+                    gdbmi->line_state = GDBMI_LINE_START;
+                data = ptr;
+                break;
+            case GDBMI_LINE_TEXT:
+                ptr = memchr(data, '\n', end - data);
+                ptr = ptr ? ptr + 1 : end;
+                gdbmi_write_output(gdbmi, data, ptr - data);
+                if (ptr[-1] == '\n')
+                    gdbmi->line_state = GDBMI_LINE_START;
+                data = ptr;
+                break;
+            case GDBMI_LINE_STREAM_START:
+                ++data;
+                if (c == '"')
+                    gdbmi->line_state = GDBMI_LINE_STREAM;
+                else if (c == '\n')
+                    gdbmi->line_state = GDBMI_LINE_START;
+                else
+                    gdbmi->line_state = GDBMI_LINE_STREAM_END;
+                break;
+            case GDBMI_LINE_STREAM:
+                /* Copy the text up to the next special character at once */
+                for (ptr = data; ptr < end && *ptr != '"' && *ptr != '\\' &&
+                        *ptr != '\n'; ++ptr);
+                gdbmi_write_output(gdbmi, data, ptr - data);
+                data = ptr;
+                if (data == end)
+                    break;
+
+                c = *data++;
+                if (c == '"')
+                    gdbmi->line_state = GDBMI_LINE_STREAM_END;
+                else if (c == '\\')
+                    gdbmi->line_state = GDBMI_LINE_STREAM_ESCAPE;
+                else
+                    gdbmi->line_state = GDBMI_LINE_START;
+                break;
+            case GDBMI_LINE_STREAM_ESCAPE:
+                ++data;
+                if (c >= '0' && c <= '7') {
+                    gdbmi->octal_value = c - '0';
+                    gdbmi->octal_digits = 1;
+                    gdbmi->line_state = GDBMI_LINE_STREAM_OCTAL;
+                } else {
+                    gdbmi_write_char(gdbmi, gdbmi_escape_char(c));
+                    gdbmi->line_state = GDBMI_LINE_STREAM;
+                }
+                break;
+            case GDBMI_LINE_STREAM_OCTAL:
+                if (c >= '0' && c <= '7') {
+                    ++data;
+                    gdbmi->octal_value = gdbmi->octal_value * 8 + (c - '0');
+                    ++gdbmi->octal_digits;
+                }
+
+                if (gdbmi->octal_digits == 3 || c < '0' || c > '7') {
+                    gdbmi_write_char(gdbmi, (char) gdbmi->octal_value);
+                    gdbmi->line_state = GDBMI_LINE_STREAM;
+                }
+                break;
+            case GDBMI_LINE_STREAM_END:
+                ptr = memchr(data, '\n', end - data);
+                if (!ptr) {
+                    data = end;
+                    break;
+                }
+
+                data = ptr + 1;
+                gdbmi->line_state = GDBMI_LINE_START;
+                break;
         }
     }
 
-    if (found_command) {
-/*		gdbmi_walk_command ( gdbmi->tgdb_cur_output_command );*/
-        ibuf_clear(gdbmi->tgdb_cur_output_command);
-    }
-
-    /* Return nothing for now */
-    *debugger_output_size = 0;
+    *debugger_output_size = gdbmi->debugger_output_size;
     *inferior_output_size = 0;
 
-    if (found_command)
-        return 1;
+    gdbmi->debugger_output = NULL;
+    gdbmi->debugger_output_size = 0;
+    gdbmi->debugger_output_capacity = 0;
+    gdbmi->cur_response_list = NULL;
 
-    return 0;
+    return gdbmi->commands_finished;
 }
 
 struct tgdb_list *gdbmi_get_client_commands(void *ctx)
@@ -487,101 +1320,107 @@ struct tgdb_list *gdbmi_get_client_commands(void *ctx)
     return gdbmi->client_command_list;
 }
 
-#if 0
-//
-//int a2_get_source_absolute_filename ( 
-//      void *ctx,
-//      const char *file ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_LIST, 
-//              file, 
-//              0 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_INFO_SOURCE_ABSOLUTE, 
-//              file, 
-//              0 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//
-//  return 0;
-//}
-//
-//int a2_get_inferior_sources ( void *ctx) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_INFO_SOURCES, 
-//              NULL, 
-//              0 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//
-//  return 0;
-//}
-//
-//int a2_change_prompt(
-//      void *ctx,
-//      const char *prompt) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//
-//    /* Must call a callback to change the prompt */
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_SET_PROMPT, 
-//              prompt, 
-//              2 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//            
-//    return 0;
-//}
-//
-//int a2_command_callback(
-//      void *ctx,
-//      const char *command) {
-//  /* Unimplemented */
-//  return -1;
-//}
-//
-//char *a2_return_client_command ( void *ctx, enum tgdb_command_type c ) {
-//  if ( c < TGDB_CONTINUE || c >= TGDB_ERROR )
-//      return NULL;
-//
-//  return a2_tgdb_commands[c];
-//}
-//
-//char *a2_client_modify_breakpoint ( 
-//      void *ctx, 
-//      const char *file, 
-//      int line, 
-//      enum tgdb_breakpoint_action b ) {
-//  char *val = (char*)cgdb_malloc ( sizeof(char)* ( strlen(file) + 128 ) );
-//
-//  if ( b == TGDB_BREAKPOINT_ADD ) {
-//      sprintf ( val, "break %s:%d", file, line ); 
-//      return val;
-//  } else if ( b == TGDB_BREAKPOINT_DELETE ) {
-//      sprintf ( val, "clear %s:%d", file, line ); 
-//      return val;
-//  } else 
-//      return NULL;
-//}
-#endif
+int gdbmi_get_source_filename_pair(void *ctx, const char *file)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+
+    return gdbmi_issue_command(gdbmi, GDBMI_COMMAND_FILENAME_PAIR,
+            "-file-list-exec-source-files\n", file);
+}
+
+int gdbmi_get_current_location(void *ctx, int on_startup)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+
+    /* GDB picks the default source file itself when nothing runs yet, so
+     * on_startup needs nothing more. */
+    return gdbmi_issue_command(gdbmi, GDBMI_COMMAND_CURRENT_LOCATION,
+            "-file-list-exec-source-file\n", NULL);
+}
+
+int gdbmi_get_inferior_sources(void *ctx)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+
+    return gdbmi_issue_command(gdbmi, GDBMI_COMMAND_INFERIOR_SOURCES,
+            "-file-list-exec-source-files\n", NULL);
+}
+
+int gdbmi_completion_callback(void *ctx, const char *command)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+    struct ibuf *mi_command = ibuf_init();
+    int ret;
+
+    ibuf_add(mi_command, "-complete ");
+    gdbmi_add_cstring(mi_command, command);
+    ibuf_addchar(mi_command, '\n');
+
+    ret = gdbmi_issue_command(gdbmi, GDBMI_COMMAND_COMPLETE,
+            ibuf_get(mi_command), NULL);
+    ibuf_free(mi_command);
+
+    return ret;
+}
+
+char *gdbmi_return_client_command(void *ctx, enum tgdb_command_type c)
+{
+    char *ret = NULL;
+
+    switch (c) {
+        case TGDB_CONTINUE:
+            ret = "continue";
+            break;
+        case TGDB_FINISH:
+            ret = "finish";
+            break;
+        case TGDB_NEXT:
+            ret = "next";
+            break;
+        case TGDB_START:
+            ret = "start";
+            break;
+        case TGDB_RUN:
+            ret = "run";
+            break;
+        case TGDB_KILL:
+            ret = "kill";
+            break;
+        case TGDB_STEP:
+            ret = "step";
+            break;
+        case TGDB_UP:
+            ret = "up";
+            break;
+        case TGDB_DOWN:
+            ret = "down";
+            break;
+        case TGDB_ERROR:
+            break;
+    }
+
+    return ret;
+}
+
+char *gdbmi_client_modify_breakpoint(void *ctx,
+        const char *file, int line, enum tgdb_breakpoint_action b)
+{
+    char *val = (char *) cgdb_malloc(sizeof (char) * (strlen(file) + 128));
+
+    if (b == TGDB_BREAKPOINT_ADD) {
+        sprintf(val, "break \"%s\":%d", file, line);
+        return val;
+    } else if (b == TGDB_BREAKPOINT_DELETE) {
+        sprintf(val, "clear \"%s\":%d", file, line);
+        return val;
+    } else if (b == TGDB_TBREAKPOINT_ADD) {
+        sprintf(val, "tbreak \"%s\":%d", file, line);
+        return val;
+    }
+
+    free(val);
+    return NULL;
+}
 
 pid_t gdbmi_get_debugger_pid(void *ctx)
 {
@@ -590,36 +1429,143 @@ pid_t gdbmi_get_debugger_pid(void *ctx)
     return gdbmi->debugger_pid;
 }
 
-#if 0
-//int a2_completion_callback(
-//      void *ctx,
-//      const char *command) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//    if ( commands_issue_command ( 
-//              a2->c, 
-//              a2->client_command_list,
-//              ANNOTATE_COMPLETE, command, 4 ) == -1 ) {
-//        err_msg("%s:%d commands_issue_command error", __FILE__, __LINE__);
-//        return -1;
-//    }
-//
-//    return 0;
-//}
-#endif
-
 int gdbmi_user_ran_command(void *ctx)
 {
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+
+    /* The user may have changed the breakpoints, the frame or the prompt.
+     * A frame change by a command like "up" has no async record. */
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_BREAK_LIST, "-break-list\n",
+            NULL);
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_STACK_INFO_FRAME,
+            "-stack-info-frame\n", NULL);
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_SHOW_PROMPT,
+            "-gdb-show prompt\n", NULL);
+
+    return 0;
+}
+
+/* Returns 1 if GDB repeats COMMAND when the user enters an empty line */
+static int gdbmi_is_repeat_command(const char *command)
+{
+    size_t length = strcspn(command, " \t");
+    int i;
+
+    for (i = 0; gdbmi_repeat_commands[i]; ++i)
+        if (strlen(gdbmi_repeat_commands[i]) == length &&
+                strncmp(gdbmi_repeat_commands[i], command, length) == 0)
+            return 1;
+
     return 0;
 }
 
 int gdbmi_prepare_for_command(void *ctx, struct tgdb_command *com)
 {
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+    struct gdbmi_command *data =
+            (struct gdbmi_command *) com->tgdb_client_private_data;
+    struct gdbmi_command command;
+    struct ibuf *buf;
+    char token[16];
+    char *console;
+    size_t length;
+
+    command.token = com->token;
+    command.command = data ? data->command : GDBMI_COMMAND_CONSOLE;
+    command.file = data ? data->file : NULL;
+    free(data);
+    com->tgdb_client_private_data = NULL;
+
+    /* Put the token in front of the command, GDB puts it in front of the
+     * result record that finishes the command. */
+    sprintf(token, "%u", com->token);
+    buf = ibuf_init();
+    ibuf_add(buf, token);
+
+    if (command.command == GDBMI_COMMAND_CONSOLE) {
+        console = cgdb_strdup(com->tgdb_command_data);
+        length = strlen(console);
+        while (length > 0 && (console[length - 1] == '\n' ||
+                        console[length - 1] == '\r'))
+            console[--length] = '\0';
+
+        /* GDB only repeats the last command on an empty line at its own
+         * console, it does not for -interpreter-exec. */
+        if (length == 0 && gdbmi->last_console_command &&
+                gdbmi_is_repeat_command(gdbmi->last_console_command)) {
+            free(console);
+            console = cgdb_strdup(gdbmi->last_console_command);
+        } else if (length > 0) {
+            free(gdbmi->last_console_command);
+            gdbmi->last_console_command = cgdb_strdup(console);
+        }
+
+        ibuf_add(buf, "-interpreter-exec console ");
+        gdbmi_add_cstring(buf, console);
+        ibuf_addchar(buf, '\n');
+        free(console);
+    } else
+        ibuf_add(buf, com->tgdb_command_data);
+
+    free(com->tgdb_command_data);
+    com->tgdb_command_data = cgdb_strdup(ibuf_get(buf));
+    ibuf_free(buf);
+
+    if (gdbmi->pending_size == gdbmi->pending_capacity) {
+        gdbmi->pending_capacity =
+                gdbmi->pending_capacity ? gdbmi->pending_capacity * 2 : 16;
+        gdbmi->pending = (struct gdbmi_command *)
+                cgdb_realloc(gdbmi->pending,
+                sizeof (struct gdbmi_command) * gdbmi->pending_capacity);
+    }
+
+    gdbmi->pending[gdbmi->pending_size++] = command;
+
     return 0;
 }
 
-#if 0
-//int a2_is_misc_prompt ( void *ctx ) {
-//  struct annotate_two *a2 = (struct annotate_two *)ctx;
-//  return globals_is_misc_prompt ( a2->g );
-//}
-#endif
+int gdbmi_is_misc_prompt(void *ctx)
+{
+    /* GDB/MI has no misc prompts, the commands always carry a token */
+    return 0;
+}
+
+int gdbmi_open_new_tty(void *ctx, int *inferior_stdin, int *inferior_stdout)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+    char *mi_command;
+    const char *slavename;
+
+    if (gdbmi->pty_pair)
+        pty_pair_destroy(gdbmi->pty_pair);
+
+    gdbmi->pty_pair = pty_pair_create();
+    if (!gdbmi->pty_pair) {
+        logger_write_pos(logger, __FILE__, __LINE__, "pty_pair_create failed");
+        return -1;
+    }
+
+    *inferior_stdin = pty_pair_get_masterfd(gdbmi->pty_pair);
+    *inferior_stdout = pty_pair_get_masterfd(gdbmi->pty_pair);
+
+    slavename = pty_pair_get_slavename(gdbmi->pty_pair);
+    mi_command = (char *) cgdb_malloc(strlen(slavename) + 32);
+    sprintf(mi_command, "-inferior-tty-set %s\n", slavename);
+    gdbmi_issue_command(gdbmi, GDBMI_COMMAND_INFERIOR_TTY, mi_command, NULL);
+    free(mi_command);
+
+    return 0;
+}
+
+const char *gdbmi_get_tty_name(void *ctx)
+{
+    struct tgdb_gdbmi *gdbmi = (struct tgdb_gdbmi *) ctx;
+
+    if (!gdbmi->pty_pair) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "gdbmi_get_tty_name failed");
+        return NULL;
+    }
+
+    return pty_pair_get_slavename(gdbmi->pty_pair);
+}
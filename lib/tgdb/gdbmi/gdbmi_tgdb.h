@@ -24,60 +24,58 @@
  */
 struct tgdb_gdbmi;
 
-/**  
- * This should probably be moved out of gdbmi_tgdb.h
+/**
+ * The commands the gdbmi context sends to GDB. Each command sent is
+ * remembered with its token, so that the result record GDB answers it with
+ * can be understood.
  */
 enum gdbmi_commands {
 
     /**
-	 * Currently not used.
-	 */
-    GDBMI_VOID = 0,
-
-    /**
-	 * Get a list of breakpoints.
-	 */
-    GDBMI_INFO_BREAKPOINTS,
+     * A command the user typed at the console. It is run with
+     * -interpreter-exec, so GDB prints its output on the console stream.
+     */
+    GDBMI_COMMAND_CONSOLE = 0,
 
     /**
-     * Tell gdb where to send inferior's output
-	 */
-    GDBMI_TTY,
+     * Get a list of breakpoints.
+     */
+    GDBMI_COMMAND_BREAK_LIST,
 
     /**
-     * Complete the current console line
-	 */
-    GDBMI_COMPLETE,
+     * Get the frame the user is looking at.
+     */
+    GDBMI_COMMAND_STACK_INFO_FRAME,
 
     /**
- 	 * Show all the sources inferior is made of
-	 */
-    GDBMI_INFO_SOURCES,
+     * Get the current source file and line, used on startup.
+     */
+    GDBMI_COMMAND_CURRENT_LOCATION,
 
     /**
-	 * relative source path.
-	 */
-    GDBMI_INFO_SOURCE_RELATIVE,
+     * Show all the sources inferior is made of
+     */
+    GDBMI_COMMAND_INFERIOR_SOURCES,
 
     /**
-	 * absolute source path.
-	 */
-    GDBMI_INFO_SOURCE_ABSOLUTE,
+     * Get the absolute and relative path of a source file.
+     */
+    GDBMI_COMMAND_FILENAME_PAIR,
 
     /**
- 	 * Shows information on the current source file
-	 */
-    GDBMI_INFO_SOURCE,
+     * Complete the current console line
+     */
+    GDBMI_COMMAND_COMPLETE,
 
     /**
- 	 * displays the contents of current source file
-	 */
-    GDBMI_LIST,
+     * Tell gdb where to send inferior's output
+     */
+    GDBMI_COMMAND_INFERIOR_TTY,
 
     /**
-	 * Sets the prompt.
-	 */
-    GDBMI_SET_PROMPT
+     * Get the prompt the console shows.
+     */
+    GDBMI_COMMAND_SHOW_PROMPT
 };
 
 /******************************************************************************/
@@ -188,6 +186,19 @@ int gdbmi_err_msg(void *ctx);
  */
 int gdbmi_is_client_ready(void *ctx);
 
+/** 
+ * This determines how many commands can be sent to GDB before the first
+ * one has finished. Each command is sent with its token, and is finished
+ * by the result record with the same token.
+ *
+ * \param ctx
+ * The gdbmi context.
+ *
+ * @return
+ * The most commands that can be in flight.
+ */
+int gdbmi_get_pipeline_depth(void *ctx);
+
 /** 
  * This lets the gdbmi know that the user ran a command.
  * The client can update itself here if it need to.
@@ -271,7 +282,7 @@ int gdbmi_is_misc_prompt(void *ctx);
   * of the libtgdb library.
   *
   * @return
-  * 1 when it has finished a command, 
+  * The number of commands it has finished, 
   * 0 on success but hasn't recieved enough I/O to finish the command, 
   * otherwise -1 on error.
   */
@@ -306,57 +317,46 @@ struct tgdb_list *gdbmi_get_client_commands(void *ctx);
 /*@h*/
 
 /** 
- * Gets the Absolute path of FILE.
+ * Gets the absolute and relative path of FILE.
  *  
  * \param ctx
  * The gdbmi context.
  *
  * \param file
- * The relative path that gdb outputted.
- *
- * @return
- * 0 on success, otherwise -1 on error.
- */
-int gdbmi_get_source_absolute_filename(void *ctx, const char *file);
-
-/** 
- * Gets all the source files that the inferior makes up.
- *
- * \param ctx
- * The gdbmi context.
+ * The path of the file, as the debugger or the user gave it.
  *
  * @return
  * 0 on success, otherwise -1 on error.
  */
-int gdbmi_get_inferior_sources(void *ctx);
+int gdbmi_get_source_filename_pair(void *ctx, const char *file);
 
 /** 
- * This will change the prompt the user sees to PROMPT.
- *
+ * Gets the current source file and line.
+ *  
  * \param ctx
  * The gdbmi context.
  *
- * \param prompt
- * The new prompt to change too.
+ * \param on_startup
+ * This variable can be set to 1 if the front end wants to probe GDB
+ * for the initial file and location of the program being debugged.
+ * However, each initial time after that, this variable should be 
+ * set to 0.
  *
  * @return
  * 0 on success, otherwise -1 on error.
  */
-int gdbmi_change_prompt(void *ctx, const char *prompt);
+int gdbmi_get_current_location(void *ctx, int on_startup);
 
 /** 
- * This is called when readline determines a command has been typed. 
+ * Gets all the source files that the inferior makes up.
  *
  * \param ctx
  * The gdbmi context.
  *
- * \param command
- * The command the user typed without the '\n'.
- *
  * @return
  * 0 on success, otherwise -1 on error.
  */
-int gdbmi_command_callback(void *ctx, const char *command);
+int gdbmi_get_inferior_sources(void *ctx);
 
 /** 
  * This is called when readline determines a command needs to be completed.
@@ -448,7 +448,7 @@ int gdbmi_open_new_tty(void *ctx, int *inferior_stdin, int *inferior_stdout);
  * @return
  * tty name on success, otherwise NULL on error.
  */
-char *gdbmi_get_tty_name(void *ctx);
+const char *gdbmi_get_tty_name(void *ctx);
 
 /*@}*/
 
@@ -489,7 +489,7 @@ int main(int argc, char **argv)
             getenv("TERM"));
 
     if ((tgdb = tgdb_initialize(NULL, argc - 1, argv + 1, &gdb_fd,
-                            &child_fd)) == NULL) {
+                            &child_fd, TGDB_PROTOCOL_ANNOTATE_TWO)) == NULL) {
         logger_write_pos(logger, __FILE__, __LINE__, "tgdb_start error");
         goto driver_end;
     }
@@ -72,12 +72,14 @@ struct tgdb {
    * The commands that need to be run through GDB.
    *
    * This is a buffered queue that represents all of the commands that TGDB
-   * needs to execute. These commands will be executed one at a time. That is,
-   * 1 command will be issued, and TGDB will wait for the entire response before
-   * issuing any more commands. It is even possible that while this command is
-   * executing, that the client context will add commands to the 
-   * oob_command_queue. If this happens TGDB will execute all of the commands
-   * in the oob_command_queue before executing the next command in this queue. 
+   * needs to execute. These commands are issued in order. TGDB issues up to
+   * the pipeline depth of them before waiting for a response. With a client
+   * that does not pipeline, 1 command will be issued, and TGDB will wait for
+   * the entire response before issuing any more commands. It is even
+   * possible that while this command is executing, that the client context
+   * will add commands to the oob_command_queue. If this happens TGDB will
+   * execute all of the commands in the oob_command_queue before executing
+   * the next command in this queue. 
    */
     struct queue *gdb_input_queue;
 
@@ -113,28 +115,38 @@ struct tgdb {
    */
     struct queue *oob_input_queue;
 
-  /** These are 2 very important state variables.  */
+  /** These are very important state variables.  */
 
   /**
-   * If set to 1, libtgdb thinks the lower level subsystem is capable of 
-   * recieving another command. It needs this so that it doesn't send 2
-   * commands to the lower level before it can say it can't recieve a command.
-   * At some point, maybe this can be removed?
-   * When its set to 0, libtgdb thinks it can not send the lower level another
-   * command.  */
-    int IS_SUBSYSTEM_READY_FOR_NEXT_COMMAND;
+   * The number of commands given to the lower level subsystem that have not
+   * finished yet. libtgdb thinks the lower level subsystem is capable of 
+   * recieving another command while this is less than the pipeline depth.
+   * It needs this so that it doesn't send more commands to the lower level
+   * than it can take before it can say it can't recieve a command.  */
+    int commands_in_flight;
+
+  /**
+   * The most commands that TGDB will have in flight at once. The client
+   * context can lower this, a client that can not match a response to its
+   * command only ever has 1 command in flight.  */
+    int pipeline_depth;
+
+  /**
+   * The token given to the next command delivered to the debugger. Clients
+   * that pipeline commands use it to match a response to its command.  */
+    unsigned int next_token;
 
   /** If ^c was hit by user */
     sig_atomic_t control_c;
 
   /**
-   * This is the last GUI command that has been run.
-   * It is used to display to the client the GUI commands.
+   * The GUI commands that have been run and not shown yet.
+   * They are used to display to the client the GUI commands.
    *
-   * It will either be NULL when it is not set or it should be
-   * the last GUI command run. If it is non-NULL it should be from the heap.
-   * As anyone is allowed to call free on it.  */
-    char *last_gui_command;
+   * Several commands can be delivered at once when they are pipelined,
+   * each one is shown by its own call to tgdb_process. The commands are
+   * from the heap.  */
+    struct queue *gui_command_queue;
 
   /**
    * This is a TGDB option.
@@ -152,6 +164,15 @@ struct tgdb {
   /** An iterator into command_list. */
     tgdb_list_iterator *command_list_iterator;
 
+  /**
+   * The buffer GDB's output is read into by tgdb_process, before the
+   * annotations are taken out. It is reused for every read, and grows to
+   * the largest size asked for.  */
+    char *read_buf;
+
+  /** The number of bytes read_buf can hold. */
+    size_t read_buf_size;
+
   /**
    * When GDB dies (purposely or not), the SIGCHLD is sent to the application controlling TGDB.
    * This data structure represents the fact that SIGCHLD has been sent.
@@ -226,14 +247,19 @@ static struct tgdb *initialize_tgdb_context(void)
     tgdb->gdb_input_queue = NULL;
     tgdb->oob_input_queue = NULL;
 
-    tgdb->IS_SUBSYSTEM_READY_FOR_NEXT_COMMAND = 1;
+    tgdb->commands_in_flight = 0;
+    tgdb->pipeline_depth = TGDB_DEFAULT_PIPELINE_DEPTH;
+    tgdb->next_token = 1;
 
-    tgdb->last_gui_command = NULL;
+    tgdb->gui_command_queue = NULL;
     tgdb->show_gui_commands = 0;
 
     tgdb->command_list = tgdb_list_init();
     tgdb->has_sigchld_recv = 0;
 
+    tgdb->read_buf = NULL;
+    tgdb->read_buf_size = 0;
+
     logger = NULL;
 
     return tgdb;
@@ -318,11 +344,13 @@ static int tgdb_initialize_logger_interface(struct tgdb *tgdb, char *config_dir)
 /* Createing and Destroying a libtgdb context. {{{*/
 
 struct tgdb *tgdb_initialize(const char *debugger,
-        int argc, char **argv, int *debugger_fd, int *inferior_fd)
+        int argc, char **argv, int *debugger_fd, int *inferior_fd,
+        enum tgdb_protocol protocol)
 {
     /* Initialize the libtgdb context */
     struct tgdb *tgdb = initialize_tgdb_context();
     char config_dir[FSUTIL_PATH_MAX];
+    enum tgdb_client_supported_protocols client_protocol;
 
     /* Create config directory */
     if (tgdb_initialize_config_dir(tgdb, config_dir) == -1) {
@@ -338,10 +366,15 @@ struct tgdb *tgdb_initialize(const char *debugger,
     tgdb->gdb_client_request_queue = queue_init();
     tgdb->gdb_input_queue = queue_init();
     tgdb->oob_input_queue = queue_init();
+    tgdb->gui_command_queue = queue_init();
+
+    if (protocol == TGDB_PROTOCOL_GDBMI)
+        client_protocol = TGDB_CLIENT_PROTOCOL_GNU_GDB_GDBMI;
+    else
+        client_protocol = TGDB_CLIENT_PROTOCOL_GNU_GDB_ANNOTATE_TWO;
 
     tgdb->tcc = tgdb_client_create_context(debugger, argc, argv, config_dir,
-            TGDB_CLIENT_DEBUGGER_GNU_GDB,
-            TGDB_CLIENT_PROTOCOL_GNU_GDB_ANNOTATE_TWO, logger);
+            TGDB_CLIENT_DEBUGGER_GNU_GDB, client_protocol, logger);
 
     /* create an instance and initialize a tgdb_client_context */
     if (tgdb->tcc == NULL) {
@@ -369,6 +402,9 @@ struct tgdb *tgdb_initialize(const char *debugger,
 
 int tgdb_shutdown(struct tgdb *tgdb)
 {
+    /* The client context may still log while it shuts down */
+    int ret = tgdb_client_destroy_context(tgdb->tcc);
+
     /* Free the logger */
     if (num_loggers == 1) {
         if (logger_destroy(logger) == -1) {
@@ -379,7 +415,11 @@ int tgdb_shutdown(struct tgdb *tgdb)
 
     --num_loggers;
 
-    return tgdb_client_destroy_context(tgdb->tcc);
+    free(tgdb->read_buf);
+    tgdb->read_buf = NULL;
+    tgdb->read_buf_size = 0;
+
+    return ret;
 }
 
 /* }}}*/
@@ -389,9 +429,37 @@ char *tgdb_err_msg(struct tgdb *tgdb)
     return NULL;
 }
 
-void command_completion_callback(struct tgdb *tgdb)
+/**
+ * Gets the most commands that can be in flight at once.
+ *
+ * \return
+ * The smaller of the configured depth and the depth the client supports.
+ */
+static int tgdb_get_pipeline_depth(struct tgdb *tgdb)
+{
+    int depth = tgdb_client_get_pipeline_depth(tgdb->tcc);
+
+    if (depth > tgdb->pipeline_depth)
+        depth = tgdb->pipeline_depth;
+
+    return depth;
+}
+
+/**
+ * Called when the client has finished commands.
+ *
+ * \param finished
+ * The number of commands the client finished.
+ */
+static void command_completion_callback(struct tgdb *tgdb, int finished)
 {
-    tgdb->IS_SUBSYSTEM_READY_FOR_NEXT_COMMAND = 1;
+    /* A client that does not pipeline is at the prompt when it finishes a
+     * command, so nothing is in flight any more. */
+    if (tgdb_get_pipeline_depth(tgdb) == 1 ||
+            finished >= tgdb->commands_in_flight)
+        tgdb->commands_in_flight = 0;
+    else
+        tgdb->commands_in_flight -= finished;
 }
 
 static char *tgdb_get_client_command(struct tgdb *tgdb,
@@ -417,7 +485,7 @@ static char *tgdb_client_modify_breakpoint_call(struct tgdb *tgdb,
  */
 static int tgdb_can_issue_command(struct tgdb *tgdb)
 {
-    if (tgdb->IS_SUBSYSTEM_READY_FOR_NEXT_COMMAND &&
+    if (tgdb->commands_in_flight < tgdb_get_pipeline_depth(tgdb) &&
             tgdb_client_is_client_ready(tgdb->tcc) &&
             (queue_size(tgdb->gdb_input_queue) == 0))
         return 1;
@@ -449,7 +517,11 @@ int tgdb_is_busy(struct tgdb *tgdb, int *is_busy)
         return -1;
     }
 
-    if (tgdb_can_issue_command(tgdb) == 1)
+    /* The pipeline depth only limits delivering another command, tgdb is
+     * busy until every command in flight has finished. */
+    if (tgdb->commands_in_flight == 0 &&
+            tgdb_client_is_client_ready(tgdb->tcc) &&
+            queue_size(tgdb->gdb_input_queue) == 0)
         *is_busy = 0;
     else
         *is_busy = 1;
@@ -625,7 +697,8 @@ tgdb_run_or_queue_command(struct tgdb *tgdb, struct tgdb_command *command)
  */
 static int tgdb_deliver_command(struct tgdb *tgdb, struct tgdb_command *command)
 {
-    tgdb->IS_SUBSYSTEM_READY_FOR_NEXT_COMMAND = 0;
+    ++tgdb->commands_in_flight;
+    command->token = tgdb->next_token++;
 
     /* Here is where the command is actually given to the debugger.
      * Before this is done, if the command is a GUI command, we save it,
@@ -634,7 +707,8 @@ static int tgdb_deliver_command(struct tgdb *tgdb, struct tgdb_command *command)
      * debugger is being given.
      */
     if (command->command_choice == TGDB_COMMAND_FRONT_END)
-        tgdb->last_gui_command = cgdb_strdup(command->tgdb_command_data);
+        queue_append(tgdb->gui_command_queue,
+                cgdb_strdup(command->tgdb_command_data));
 
     /* A command for the debugger */
     if (tgdb_client_prepare_for_command(tgdb->tcc, command) == -1)
@@ -731,18 +805,14 @@ int tgdb_send_inferior_char(struct tgdb *tgdb, char c)
 /* returns to the caller data from the child */
 size_t tgdb_recv_inferior_data(struct tgdb * tgdb, char *buf, size_t n)
 {
-    char local_buf[n + 1];
     ssize_t size;
 
     /* read all the data possible from the child that is ready. */
-    if ((size = io_read(tgdb->inferior_stdin, local_buf, n)) < 0) {
+    if ((size = io_read(tgdb->inferior_stdin, buf, n)) < 0) {
         logger_write_pos(logger, __FILE__, __LINE__, "inferior_fd read failed");
         return -1;
     }
 
-    strncpy(buf, local_buf, size);
-    buf[size] = '\0';
-
     return size;
 }
 
@@ -836,7 +906,7 @@ static int tgdb_get_quit_command(struct tgdb *tgdb, int *tgdb_will_quit)
 
 size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
 {
-    char local_buf[10 * n];
+    char *local_buf;
     ssize_t size;
     size_t buf_size = 0;
     int is_busy;
@@ -853,7 +923,8 @@ size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
      * Currently, I see it as a bigger hack to try to just append this to the
      * beggining of buf.
      */
-    if (tgdb->last_gui_command != NULL) {
+    if (queue_size(tgdb->gui_command_queue) > 0) {
+        char *gui_command = (char *) queue_pop(tgdb->gui_command_queue);
         int ret;
 
         if (tgdb_is_busy(tgdb, &is_busy) == -1) {
@@ -863,15 +934,14 @@ size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
         *is_finished = !is_busy;
 
         if (tgdb->show_gui_commands) {
-            strcpy(buf, tgdb->last_gui_command);
-            ret = strlen(tgdb->last_gui_command);
+            strcpy(buf, gui_command);
+            ret = strlen(gui_command);
         } else {
             strcpy(buf, "\n");
             ret = 1;
         }
 
-        free(tgdb->last_gui_command);
-        tgdb->last_gui_command = NULL;
+        free(gui_command);
         return ret;
     }
 
@@ -897,8 +967,17 @@ size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
             goto tgdb_finish;
     }
 
-    /* set buf to null for debug reasons */
-    memset(buf, '\0', n);
+    /* The read buffer only grows, so it is allocated once in practice */
+    if (tgdb->read_buf_size < n + 1) {
+        local_buf = (char *) realloc(tgdb->read_buf, n + 1);
+        if (!local_buf) {
+            logger_write_pos(logger, __FILE__, __LINE__, "realloc failed");
+            return -1;
+        }
+        tgdb->read_buf = local_buf;
+        tgdb->read_buf_size = n + 1;
+    }
+    local_buf = tgdb->read_buf;
 
     /* 1. read all the data possible from gdb that is ready. */
     if ((size = io_read(tgdb->debugger_stdout, local_buf, n)) < 0) {
@@ -934,9 +1013,9 @@ size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
 
         if (result == 0) {
             /* success, and more to parse, ss isn't done */
-        } else if (result == 1) {
-            /* success, and finished command */
-            command_completion_callback(tgdb);
+        } else if (result > 0) {
+            /* success, and finished commands */
+            command_completion_callback(tgdb, result);
         } else if (result == -1) {
             logger_write_pos(logger, __FILE__, __LINE__,
                     "tgdb_client_parse_io failed");
@@ -952,10 +1031,15 @@ size_t tgdb_process(struct tgdb * tgdb, char *buf, size_t n, int *is_finished)
         return -1;
     }
 
-    /* 4. runs the users buffered command if any exists */
-    if (tgdb_has_command_to_run(tgdb))
+    /* 4. runs the users buffered commands if any exist, as many as the
+     *    pipeline has room for */
+    while (tgdb_has_command_to_run(tgdb)) {
         tgdb_unqueue_and_deliver_command(tgdb);
 
+        if (tgdb->commands_in_flight >= tgdb_get_pipeline_depth(tgdb))
+            break;
+    }
+
   tgdb_finish:
 
     /* Set the iterator to the beggining. So when the user
@@ -1425,6 +1509,14 @@ int tgdb_set_verbose_gui_command_output(struct tgdb *tgdb, int value)
     return 0;
 }
 
+int tgdb_set_pipeline_depth(struct tgdb *tgdb, int depth)
+{
+    if (depth >= 1)
+        tgdb->pipeline_depth = depth;
+
+    return tgdb->pipeline_depth;
+}
+
 int tgdb_set_verbose_error_handling(struct tgdb *tgdb, int value)
 {
     if (value == -1)
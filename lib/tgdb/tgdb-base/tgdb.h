@@ -64,11 +64,15 @@ extern "C" {
    * \param inferior_fd
    * The descriptor to the I/O of the program being debugged.
    *
+   * \param protocol
+   * The protocol TGDB uses to talk to the debugger.
+   *
    * @return
    * NULL on error, a valid context on success.
    */
     struct tgdb *tgdb_initialize(const char *debugger,
-            int argc, char **argv, int *debugger_fd, int *inferior_fd);
+            int argc, char **argv, int *debugger_fd, int *inferior_fd,
+            enum tgdb_protocol protocol);
 
   /**
    * This will terminate a libtgdb session. No functions should be called on
@@ -161,7 +165,8 @@ extern "C" {
    *
    * \param buf
    * The output of the debugger will be returned in this buffer.
-   * The buffer passed back will not exceed N in size.
+   * The buffer passed back will not exceed N in size, and is not NUL
+   * terminated. The caller can reuse the same buffer for every call.
    *
    * \param n
    * Tells libtgdb how large the buffer BUF is that the client passed in.
@@ -200,7 +205,8 @@ extern "C" {
    * An instance of the tgdb library to operate on.
    *
    * \param buf
-   * The output of the program being debugged will be returned here.
+   * The output of the program being debugged will be read directly into
+   * this buffer. It is not NUL terminated.
    *
    * \param n
    * Tells libtgdb how large the buffer BUF is.
@@ -567,6 +573,28 @@ extern "C" {
    */
     int tgdb_set_verbose_gui_command_output(struct tgdb *tgdb, int value);
 
+  /** The number of commands TGDB has in flight at once by default. */
+#define TGDB_DEFAULT_PIPELINE_DEPTH 4
+
+  /**
+   * This sets the most commands TGDB will send to the debugger before it
+   * waits for a response. The responses are matched back to their command
+   * by the token TGDB gives each command. This only takes effect when the
+   * client context supports it, otherwise TGDB sends 1 command at a time.
+   * The default value is TGDB_DEFAULT_PIPELINE_DEPTH.
+   *
+   * \param tgdb
+   * An instance of the tgdb library to operate on.
+   *
+   * \param depth
+   * The most commands to have in flight. Use a value less than 1 just to
+   * query the option.
+   *
+   * @return
+   * The pipeline depth.
+   */
+    int tgdb_set_pipeline_depth(struct tgdb *tgdb, int depth);
+
   /**
    * This will make TGDB handle error's in a verbose mode.
    * The basically mean's that when TGDB find's an error, the message is
@@ -37,6 +37,8 @@ static struct tgdb_client_debugger_interfaces {
 
     int (*tgdb_client_is_client_ready) (void *ctx);
 
+    int (*tgdb_client_get_pipeline_depth) (void *ctx);
+
     int (*tgdb_client_tgdb_ran_command) (void *ctx);
 
     int (*tgdb_client_prepare_for_command) (void *ctx,
@@ -86,6 +88,8 @@ static struct tgdb_client_debugger_interfaces {
                 a2_err_msg,
                 /* tgdb_client_is_client_ready */
                 a2_is_client_ready,
+                /* tgdb_client_get_pipeline_depth */
+                NULL,
                 /* tgdb_client_tgdb_ran_command */
                 a2_user_ran_command,
                 /* tgdb_client_prepare_for_command */
@@ -122,37 +126,39 @@ static struct tgdb_client_debugger_interfaces {
                 /* tgdb_client_destroy_context */
                 gdbmi_shutdown,
                 /* tgdb_client_err_msg */
-                NULL,
+                gdbmi_err_msg,
                 /* tgdb_client_is_client_ready */
                 gdbmi_is_client_ready,
+                /* tgdb_client_get_pipeline_depth */
+                gdbmi_get_pipeline_depth,
                 /* tgdb_client_tgdb_ran_command */
                 gdbmi_user_ran_command,
                 /* tgdb_client_prepare_for_command */
                 gdbmi_prepare_for_command,
                 /* tgdb_client_can_tgdb_run_commands */
-                NULL,
+                gdbmi_is_misc_prompt,
                 /* tgdb_client_parse_io */
                 gdbmi_parse_io,
                 /* tgdb_client_get_client_commands */
                 gdbmi_get_client_commands,
                 /* tgdb_client_get_filename_pair */
-                NULL,
+                gdbmi_get_source_filename_pair,
                 /* tgdb_client_get_current_location */
-                NULL,
+                gdbmi_get_current_location,
                 /* tgdb_client_get_inferior_source_files */
-                NULL,
+                gdbmi_get_inferior_sources,
                 /* tgdb_client_completion_callback */
-                NULL,
+                gdbmi_completion_callback,
                 /* tgdb_client_return_command */
-                NULL,
+                gdbmi_return_client_command,
                 /* tgdb_client_modify_breakpoint */
-                NULL,
+                gdbmi_client_modify_breakpoint,
                 /* tgdb_client_get_debugger_pid */
                 gdbmi_get_debugger_pid,
                 /* tgdb_client_open_new_tty */
-                NULL,
+                gdbmi_open_new_tty,
                 /* tgdb_client_get_tty_name */
-    NULL}, {
+    gdbmi_get_tty_name}, {
         TGDB_CLIENT_DEBUGGER_UNSUPPORTED, TGDB_CLIENT_PROTOCOL_UNSUPPORTED,
                 /* tgdb_client_create_context */
                 NULL,
@@ -164,6 +170,8 @@ static struct tgdb_client_debugger_interfaces {
                 NULL,
                 /* tgdb_client_is_client_ready */
                 NULL,
+                /* tgdb_client_get_pipeline_depth */
+                NULL,
                 /* tgdb_client_tgdb_ran_command */
                 NULL,
                 /* tgdb_client_prepare_for_command */
@@ -311,6 +319,22 @@ int tgdb_client_is_client_ready(struct tgdb_client_context *tcc)
             tgdb_debugger_context);
 }
 
+int tgdb_client_get_pipeline_depth(struct tgdb_client_context *tcc)
+{
+    if (tcc == NULL || tcc->tgdb_client_interface == NULL) {
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "tgdb_client_get_pipeline_depth unimplemented");
+        return 1;
+    }
+
+    /* Clients that do not pipeline run 1 command at a time */
+    if (tcc->tgdb_client_interface->tgdb_client_get_pipeline_depth == NULL)
+        return 1;
+
+    return tcc->tgdb_client_interface->tgdb_client_get_pipeline_depth(tcc->
+            tgdb_debugger_context);
+}
+
 int tgdb_client_tgdb_ran_command(struct tgdb_client_context *tcc)
 {
     if (tcc == NULL || tcc->tgdb_client_interface == NULL) {
@@ -231,6 +231,18 @@ int tgdb_client_err_msg(struct tgdb_client_context *tcc);
  */
 int tgdb_client_is_client_ready(struct tgdb_client_context *tcc);
 
+/** 
+ * This determines how many commands TGDB can send to the debugger before
+ * the first one has finished. A client that can match each response to the
+ * command by its token can have several commands in flight.
+ * \param tcc
+ * The client context.
+ * @return
+ * The most commands the client can have in flight, 1 if the client does
+ * not pipeline commands.
+ */
+int tgdb_client_get_pipeline_depth(struct tgdb_client_context *tcc);
+
 /** 
  * This is currently called after TGDB has sent a command to the debugger.
  * Currently, the client can run commands that has to be run ( for TGDB ) 
@@ -325,9 +337,11 @@ int tgdb_client_can_tgdb_run_commands(struct tgdb_client_context *tcc);
   * client generated.
   *
   * @return
-  * 1 when it has finished a command, 
+  * The number of commands it has finished, 
   * 0 on success but hasn't recieved enough I/O to finish the command, 
   * otherwise -1 on error.
+  * A client that does not pipeline commands returns 1 when the debugger is
+  * ready for the next command.
   *
   * \post
   * debugger_output, debugger_output_size, inferior_output, 
@@ -32,6 +32,7 @@ struct tgdb_command *tgdb_command_create(const char *tgdb_command_data,
 
     tc->command_choice = command_choice;
     tc->tgdb_client_private_data = client_data;
+    tc->token = 0;
 
     return tc;
 }
@@ -68,6 +68,13 @@ struct tgdb_command {
 
     /** Private data the client context can use. */
     void *tgdb_client_private_data;
+
+    /**
+	 * The token TGDB gave this command when it was delivered. A client
+	 * that pipelines commands uses it to match a response to its command.
+	 * It is 0 until the command is delivered.
+	 */
+    unsigned int token;
 };
 
 /**
@@ -25,6 +25,7 @@
 #include "ibuf.h"
 #include "tgdb_list.h"
 #include "queue.h"
+#include "std_hash.h"
 
 static int tgdb_types_print_item(void *command)
 {
@@ -56,8 +57,10 @@ static int tgdb_types_print_item(void *command)
                             "breakpoint is NULL");
 
                 fprintf(fd,
-                        "\tFILE(%s) FUNCNAME(%s) LINE(%d) ENABLED(%d)\n",
-                        tb->file, tb->funcname, tb->line, tb->enabled);
+                        "\tFILE(%s) FUNCNAME(%s) LINE(%d) ENABLED(%d) "
+                        "CHANGE(%d)\n",
+                        tb->file, tb->funcname, tb->line, tb->enabled,
+                        tb->change);
 
                 iterator = tgdb_list_next(iterator);
             }
@@ -198,6 +201,7 @@ static int tgdb_types_delete_item(void *command)
                     com->choice.update_breakpoints.breakpoint_list;
 
             tgdb_list_free(list, tgdb_types_breakpoint_free);
+            tgdb_list_destroy(list);
             break;
         }
         case TGDB_UPDATE_FILE_POSITION:
@@ -294,3 +298,92 @@ tgdb_types_append_command(struct tgdb_list *command_list,
 {
     tgdb_list_append(command_list, response);
 }
+
+/* The state used when comparing two sets of breakpoints */
+struct breakpoint_delta {
+    /* The breakpoints to compare against */
+    struct std_hashtable *other;
+    /* The breakpoints that differ */
+    struct tgdb_list *delta;
+    /* How the breakpoints that are not in other changed */
+    enum tgdb_breakpoint_change change;
+};
+
+static struct tgdb_breakpoint *breakpoint_copy(const struct tgdb_breakpoint
+        *tb, enum tgdb_breakpoint_change change)
+{
+    struct tgdb_breakpoint *copy = (struct tgdb_breakpoint *)
+            cgdb_malloc(sizeof (struct tgdb_breakpoint));
+
+    copy->file = tb->file ? cgdb_strdup(tb->file) : NULL;
+    copy->funcname = tb->funcname ? cgdb_strdup(tb->funcname) : NULL;
+    copy->line = tb->line;
+    copy->enabled = tb->enabled;
+    copy->change = change;
+
+    return copy;
+}
+
+static void breakpoint_compare(void *key, void *value, void *user_data)
+{
+    struct breakpoint_delta *d = (struct breakpoint_delta *) user_data;
+    struct tgdb_breakpoint *tb = (struct tgdb_breakpoint *) value;
+    struct tgdb_breakpoint *other = (struct tgdb_breakpoint *)
+            std_hash_table_lookup(d->other, key);
+
+    if (!other)
+        tgdb_list_append(d->delta, breakpoint_copy(tb, d->change));
+    else if (d->change == TGDB_BREAKPOINT_ADDED &&
+            other->enabled != tb->enabled)
+        tgdb_list_append(d->delta,
+                breakpoint_copy(tb, TGDB_BREAKPOINT_CHANGED));
+}
+
+struct std_hashtable *tgdb_types_breakpoint_table_create(void)
+{
+    return std_hash_table_new_full(std_str_hash, std_str_equal,
+            tgdb_types_source_files_free, tgdb_types_breakpoint_free);
+}
+
+struct tgdb_list *tgdb_types_breakpoint_delta(struct std_hashtable **table,
+        struct tgdb_list *breakpoint_list)
+{
+    struct std_hashtable *listed;
+    struct breakpoint_delta d;
+    tgdb_list_iterator *iterator;
+    struct tgdb_breakpoint *tb;
+    char *key;
+
+    listed = tgdb_types_breakpoint_table_create();
+
+    /* The table takes over the listed breakpoints */
+    for (iterator = tgdb_list_get_first(breakpoint_list); iterator;
+            iterator = tgdb_list_next(iterator)) {
+        tb = (struct tgdb_breakpoint *) tgdb_list_get_item(iterator);
+
+        if (!tb->file) {
+            tgdb_types_breakpoint_free(tb);
+            continue;
+        }
+
+        key = (char *) cgdb_malloc(strlen(tb->file) + 16);
+        sprintf(key, "%s:%d", tb->file, tb->line);
+        std_hash_table_replace(listed, key, tb);
+    }
+    tgdb_list_clear(breakpoint_list);
+
+    d.delta = tgdb_list_init();
+
+    d.other = *table;
+    d.change = TGDB_BREAKPOINT_ADDED;
+    std_hash_table_foreach(listed, breakpoint_compare, &d);
+
+    d.other = listed;
+    d.change = TGDB_BREAKPOINT_REMOVED;
+    std_hash_table_foreach(*table, breakpoint_compare, &d);
+
+    std_hash_table_destroy(*table);
+    *table = listed;
+
+    return d.delta;
+}
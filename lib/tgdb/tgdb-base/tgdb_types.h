@@ -23,6 +23,7 @@ extern "C" {
     /* A reference to a command that has been created by TGDB */
     struct tgdb_command;
     struct tgdb_response;
+    struct std_hashtable;
 
 /******************************************************************************/
 /**
@@ -67,8 +68,55 @@ extern "C" {
     void tgdb_types_append_command(struct tgdb_list *command_list,
             struct tgdb_response *response);
 
+ /**
+  * Creates the table the breakpoints that were sent to the front end are
+  * remembered in. It is used with tgdb_types_breakpoint_delta and destroyed
+  * with std_hash_table_destroy.
+  *
+  * @return
+  * The new, empty, table.
+  */
+    struct std_hashtable *tgdb_types_breakpoint_table_create(void);
+
+ /**
+  * Compares the breakpoints the debugger listed with the ones sent to the
+  * front end the last time. The listed breakpoints become the ones sent to
+  * the front end.
+  *
+  * Breakpoints are identified by their file and line. When several
+  * breakpoints are set on the same line, the last one listed decides if the
+  * line has an enabled breakpoint.
+  *
+  * \param table
+  * The breakpoints sent to the front end the last time. On return, it is
+  * replaced by a table of the listed breakpoints.
+  *
+  * \param breakpoint_list
+  * The 'struct tgdb_breakpoint *' the debugger listed. The new table takes
+  * them over, and the list is left empty.
+  *
+  * @return
+  * A list of the breakpoints that were added, removed or changed. It is
+  * empty when nothing changed.
+  */
+    struct tgdb_list *tgdb_types_breakpoint_delta(struct std_hashtable **table,
+            struct tgdb_list *breakpoint_list);
+
 /*@}*/
 
+ /**
+  * The protocols TGDB can use to talk to the debugger. The front end picks
+  * one when it calls tgdb_initialize.
+  */
+    enum tgdb_protocol {
+
+    /** Scrape the output GDB prints with 'set annotate 2'.  */
+        TGDB_PROTOCOL_ANNOTATE_TWO = 0,
+
+    /** Parse the records of GDB's machine interface (GDB/MI).  */
+        TGDB_PROTOCOL_GDBMI
+    };
+
  /**
   * The client can give any of these commands to TGDB through 
   * tgdb_run_debugger_command.
@@ -139,6 +187,21 @@ extern "C" {
         TGDB_BREAKPOINT_ENABLE
     };
 
+ /**
+  * How a breakpoint changed since the previous breakpoint update.
+  */
+    enum tgdb_breakpoint_change {
+
+    /** The breakpoint was not set before.  */
+        TGDB_BREAKPOINT_ADDED,
+
+    /** The breakpoint is no longer set.  */
+        TGDB_BREAKPOINT_REMOVED,
+
+    /** The breakpoint was enabled or disabled.  */
+        TGDB_BREAKPOINT_CHANGED
+    };
+
  /**
   * This structure represents a breakpoint.
   */
@@ -158,6 +221,9 @@ extern "C" {
 
     /** 0 if it is not enabled or 1 if it is enabled.  */
         int enabled;
+
+    /** How the breakpoint changed since the previous update.  */
+        enum tgdb_breakpoint_change change;
     };
 
  /**
@@ -276,7 +342,10 @@ extern "C" {
   */
     enum INTERFACE_RESPONSE_COMMANDS {
 
-    /** All breakpoints that are set.  */
+    /**
+     * The breakpoints that were added, removed, enabled or disabled since
+     * the previous breakpoint update.
+     */
         TGDB_UPDATE_BREAKPOINTS,
 
     /**
@@ -354,7 +423,8 @@ extern "C" {
             /* header == TGDB_UPDATE_BREAKPOINTS */
             struct {
                 /* This list has elements of 'struct tgdb_breakpoint *' 
-                 * representing each breakpoint. */
+                 * representing each breakpoint that changed. A breakpoint
+                 * is identified by its file and line. */
                 struct tgdb_list *breakpoint_list;
             } update_breakpoints;
 
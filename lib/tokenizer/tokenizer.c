@@ -1,6 +1,8 @@
 #include "tokenizer.h"
+#include "tokenizer_input.h"
 #include "sys_util.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 /* Some default file extensions */
@@ -10,23 +12,48 @@ char *c_extensions[] = {
 char *d_extensions[] = { ".d", ".di" };
 char *ada_extensions[] = { ".adb", ".ads", ".ada", ".ADB", ".ADS", ".ADA" };
 
-extern int c_lex(void);
-extern FILE *c_in;
-extern char *c_text;
+/* The reentrant lexers, see tokenizer_input.h */
+extern int c_lex_init_extra(struct tokenizer_input *in, void **scanner);
+extern int c_lex_destroy(void *scanner);
+extern int c_lex(void *scanner);
+extern char *c_get_text(void *scanner);
+extern void c_restart(FILE * input_file, void *scanner);
+extern int c_get_start_state(void *scanner);
+extern void c_set_start_state(int state, void *scanner);
 
-extern int d_lex(void);
-extern FILE *d_in;
-extern char *d_text;
+extern int d_lex_init_extra(struct tokenizer_input *in, void **scanner);
+extern int d_lex_destroy(void *scanner);
+extern int d_lex(void *scanner);
+extern char *d_get_text(void *scanner);
+extern void d_restart(FILE * input_file, void *scanner);
+extern int d_get_start_state(void *scanner);
+extern void d_set_start_state(int state, void *scanner);
 
-extern int ada_lex(void);
-extern FILE *ada_in;
-extern char *ada_text;
+extern int ada_lex_init_extra(struct tokenizer_input *in, void **scanner);
+extern int ada_lex_destroy(void *scanner);
+extern int ada_lex(void *scanner);
+extern char *ada_get_text(void *scanner);
+extern void ada_restart(FILE * input_file, void *scanner);
+extern int ada_get_start_state(void *scanner);
+extern void ada_set_start_state(int state, void *scanner);
 
 struct tokenizer {
     enum tokenizer_language_support lang;
-    int (*tokenizer_lex) (void);
-    FILE **tokenizer_in;
-    char **tokenizer_text;
+    int (*tokenizer_lex_init_extra) (struct tokenizer_input * in,
+            void **scanner);
+    int (*tokenizer_lex_destroy) (void *scanner);
+    int (*tokenizer_lex) (void *scanner);
+    char *(*tokenizer_get_text) (void *scanner);
+    void (*tokenizer_restart) (FILE * input_file, void *scanner);
+    int (*tokenizer_get_start_state) (void *scanner);
+    void (*tokenizer_set_start_state) (int state, void *scanner);
+
+    /* The lexer's state, and the text it reads */
+    void *scanner;
+    struct tokenizer_input input;
+
+    /* The file contents, when tokenizing a file */
+    char *file_data;
 
     enum tokenizer_type tpacket;
     struct ibuf *i;
@@ -38,58 +65,177 @@ struct tokenizer *tokenizer_init(void)
             (struct tokenizer *) cgdb_malloc(sizeof (struct tokenizer));
     n->i = ibuf_init();
     n->lang = TOKENIZER_LANGUAGE_UNKNOWN;
+    n->tokenizer_lex_init_extra = NULL;
+    n->tokenizer_lex_destroy = NULL;
     n->tokenizer_lex = NULL;
-    n->tokenizer_in = NULL;
-    n->tokenizer_text = NULL;
+    n->tokenizer_get_text = NULL;
+    n->tokenizer_restart = NULL;
+    n->tokenizer_get_start_state = NULL;
+    n->tokenizer_set_start_state = NULL;
+    n->scanner = NULL;
+    n->input.buffer = NULL;
+    n->input.size = 0;
+    n->input.pos = 0;
+    n->input.nesting_level = 0;
+    n->file_data = NULL;
     return n;
 }
 
+/* Releases the lexer and the file contents of a tokenizer */
+static void tokenizer_release(struct tokenizer *t)
+{
+    if (t->scanner)
+        (t->tokenizer_lex_destroy) (t->scanner);
+    t->scanner = NULL;
+
+    free(t->file_data);
+    t->file_data = NULL;
+}
+
+void tokenizer_destroy(struct tokenizer *t)
+{
+    if (!t)
+        return;
+
+    tokenizer_release(t);
+    ibuf_free(t->i);
+    free(t);
+}
+
 int tokenizer_set_file(struct tokenizer *t, const char *file,
         enum tokenizer_language_support l)
 {
+    FILE *fd;
+    char *data;
+    size_t size = 0, nread;
+    int result;
+
+    fd = fopen(file, "r");
+
+    if (!fd) {
+        fprintf(stderr, "%s:%d tokizer_set_file error", __FILE__, __LINE__);
+        return -1;
+    }
+
+    /* Read the whole file, the lexers tokenize text in memory */
+    data = cgdb_malloc(BUFSIZ);
+    while ((nread = fread(data + size, 1, BUFSIZ, fd)) > 0) {
+        size += nread;
+        data = cgdb_realloc(data, size + BUFSIZ);
+    }
+
+    fclose(fd);
 
+    result = tokenizer_set_buffer(t, data, size, l);
+
+    /* Set after tokenizer_set_buffer, which releases the previous file */
+    t->file_data = data;
+
+    return result;
+}
+
+int tokenizer_set_buffer(struct tokenizer *t, const char *buffer,
+        size_t size, enum tokenizer_language_support l)
+{
     if (l < TOKENIZER_ENUM_START_POS || l >= TOKENIZER_LANGUAGE_UNKNOWN)
         return 0;
 
+    tokenizer_release(t);
+
     t->lang = l;
 
     if (l == TOKENIZER_LANGUAGE_C) {
+        t->tokenizer_lex_init_extra = c_lex_init_extra;
+        t->tokenizer_lex_destroy = c_lex_destroy;
         t->tokenizer_lex = c_lex;
-        t->tokenizer_in = &c_in;
-        t->tokenizer_text = &c_text;
+        t->tokenizer_get_text = c_get_text;
+        t->tokenizer_restart = c_restart;
+        t->tokenizer_get_start_state = c_get_start_state;
+        t->tokenizer_set_start_state = c_set_start_state;
     } else if (l == TOKENIZER_LANGUAGE_D) {
+        t->tokenizer_lex_init_extra = d_lex_init_extra;
+        t->tokenizer_lex_destroy = d_lex_destroy;
         t->tokenizer_lex = d_lex;
-        t->tokenizer_in = &d_in;
-        t->tokenizer_text = &d_text;
+        t->tokenizer_get_text = d_get_text;
+        t->tokenizer_restart = d_restart;
+        t->tokenizer_get_start_state = d_get_start_state;
+        t->tokenizer_set_start_state = d_set_start_state;
     } else {
+        t->tokenizer_lex_init_extra = ada_lex_init_extra;
+        t->tokenizer_lex_destroy = ada_lex_destroy;
         t->tokenizer_lex = ada_lex;
-        t->tokenizer_in = &ada_in;
-        t->tokenizer_text = &ada_text;
+        t->tokenizer_get_text = ada_get_text;
+        t->tokenizer_restart = ada_restart;
+        t->tokenizer_get_start_state = ada_get_start_state;
+        t->tokenizer_set_start_state = ada_set_start_state;
     }
 
-    *(t->tokenizer_in) = fopen(file, "r");
+    t->input.buffer = buffer;
+    t->input.size = size;
+    t->input.pos = 0;
+    t->input.nesting_level = 0;
 
-    if (!(*(t->tokenizer_in))) {
-        fprintf(stderr, "%s:%d tokizer_set_file error", __FILE__, __LINE__);
+    if ((t->tokenizer_lex_init_extra) (&t->input, &t->scanner) != 0) {
+        t->scanner = NULL;
         return -1;
     }
 
     return 0;
 }
 
+int tokenizer_get_state(struct tokenizer *t)
+{
+    if (t == NULL || t->scanner == NULL)
+        return TOKENIZER_INITIAL_STATE;
+
+    return (t->tokenizer_get_start_state) (t->scanner);
+}
+
+int tokenizer_seek(struct tokenizer *t, long offset, int state)
+{
+    if (t == NULL || t->scanner == NULL)
+        return -1;
+
+    if (offset < 0 || offset > t->input.size)
+        return -1;
+
+    /* Discard what the lexer has read ahead of its position */
+    t->input.pos = offset;
+    (t->tokenizer_restart) (NULL, t->scanner);
+    (t->tokenizer_set_start_state) (state, t->scanner);
+
+    return 0;
+}
+
+int tokenizer_input_read(struct tokenizer_input *in, char *buf, int max_size)
+{
+    int i;
+
+    for (i = 0; i < max_size && in->pos < in->size; i++, in->pos++) {
+        buf[i] = in->buffer[in->pos];
+
+        if (buf[i] == '\0') {
+            if (in->pos + 1 < in->size && in->buffer[in->pos + 1] == '\n')
+                buf[i] = '\r';
+            else
+                buf[i] = '\n';
+        }
+    }
+
+    return i;
+}
+
 int tokenizer_get_token(struct tokenizer *t)
 {
-    if (t == NULL || t->tokenizer_lex == NULL)
+    if (t == NULL || t->scanner == NULL)
         return 0;
 
-    t->tpacket = (t->tokenizer_lex) ();
+    t->tpacket = (t->tokenizer_lex) (t->scanner);
     ibuf_clear(t->i);
-    ibuf_add(t->i, (const char *) *(t->tokenizer_text));
+    ibuf_add(t->i, (const char *) (t->tokenizer_get_text) (t->scanner));
 
-    if (!(t->tpacket)) {
-        fclose(*(t->tokenizer_in));
+    if (!(t->tpacket))
         return 0;
-    }
 
     return 1;
 }
@@ -19,6 +19,9 @@ enum tokenizer_type {
     TOKENIZER_ERROR
 };
 
+/* The lexer state at the beginning of a file */
+#define TOKENIZER_INITIAL_STATE 0
+
 enum tokenizer_language_support {
     TOKENIZER_LANGUAGE_C = TOKENIZER_ENUM_START_POS,
     TOKENIZER_LANGUAGE_D,
@@ -59,6 +62,52 @@ void tokenizer_destroy(struct tokenizer *t);
 int tokenizer_set_file(struct tokenizer *t, const char *file,
         enum tokenizer_language_support l);
 
+/* tokenizer_set_buffer
+ * --------------------
+ *
+ *  This functions will prepare the tokenizer to parse text in memory.
+ *  The text is not copied, it must stay valid while it is tokenized.
+ *  NUL bytes are read as line endings, so the lines of the text may be
+ *  NUL terminated in place, see tokenizer_input_read.
+ *  
+ *  t:      The tokenizer object to work on
+ *  buffer: The text to tokenize.
+ *  size:   The size of the text in bytes.
+ *
+ *  Return: -1 on error. 0 on success
+ */
+int tokenizer_set_buffer(struct tokenizer *t, const char *buffer,
+        size_t size, enum tokenizer_language_support l);
+
+/* tokenizer_get_state
+ * -------------------
+ *
+ *  This returns the state the lexer is in at the current position of
+ *  the text. It is only meaningful at the beginning of a line, that is, 
+ *  before the first token or right after a TOKENIZER_NEWLINE token.
+ *  Together with the line's offset, it allows tokenizing to be resumed 
+ *  at that line later with tokenizer_seek.
+ *
+ *  t:      The tokenizer object to work on
+ *
+ *  Return: The lexer state.
+ */
+int tokenizer_get_state(struct tokenizer *t);
+
+/* tokenizer_seek
+ * --------------
+ *
+ *  This will continue tokenizing the text at a new position.
+ *
+ *  t:      The tokenizer object to work on
+ *  offset: The offset in bytes, from the beginning of the text, of a line.
+ *  state:  The lexer state at that line, as returned by tokenizer_get_state.
+ *          TOKENIZER_INITIAL_STATE for the beginning of the file.
+ *
+ *  Return: -1 on error. 0 on success
+ */
+int tokenizer_seek(struct tokenizer *t, long offset, int state);
+
 /* tokenizer_get_token
  * -------------------
  *
@@ -0,0 +1,39 @@
+#ifndef __TOKENIZER_INPUT_H__
+#define __TOKENIZER_INPUT_H__
+
+#include <stddef.h>
+
+/* The input of a lexer. 
+ *
+ * Each lexer is a reentrant flex scanner, and this is its extra data. It
+ * reads the text of the buffer being tokenized through tokenizer_input_read,
+ * so no lexer state is shared between tokenizers. */
+struct tokenizer_input {
+    const char *buffer;         /* The text being tokenized */
+    size_t size;                /* The size of the text in bytes */
+    size_t pos;                 /* The offset of the next byte to read */
+    int nesting_level;          /* Depth of a nested comment, for lexers
+                                 * with nesting comments */
+};
+
+/* tokenizer_input_read
+ * --------------------
+ *
+ *  This copies the next bytes of the text into a lexer's buffer.
+ *  A NUL byte is read as a line ending, '\r' when '\n' follows it and
+ *  '\n' otherwise, so text whose lines were NUL terminated in place 
+ *  tokenizes the same as the original text.
+ *
+ *  in:       The input to read from
+ *  buf:      The lexer's buffer
+ *  max_size: The size of buf
+ *
+ *  Return: The number of bytes copied, 0 at the end of the text.
+ */
+int tokenizer_input_read(struct tokenizer_input *in, char *buf, int max_size);
+
+/* Lets a lexer read its input with tokenizer_input_read */
+#define TOKENIZER_YY_INPUT(buf, result, max_size) \
+    result = tokenizer_input_read(yyextra, buf, max_size)
+
+#endif /* __TOKENIZER_INPUT_H__ */
@@ -0,0 +1,520 @@
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif /* HAVE_CONFIG_H */
+
+#if HAVE_STDLIB_H
+#include <stdlib.h>
+#endif /* HAVE_STDLIB_H */
+
+#if HAVE_STRING_H
+#include <string.h>
+#endif /* HAVE_STRING_H */
+
+#if HAVE_ERRNO_H
+#include <errno.h>
+#endif /* HAVE_ERRNO_H */
+
+#if HAVE_UNISTD_H
+#include <unistd.h>
+#endif /* HAVE_UNISTD_H */
+
+#if HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif /* HAVE_SYS_TYPES_H */
+
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif /* HAVE_TIME_H */
+
+#ifdef HAVE_SYS_SELECT_H
+#include <sys/select.h>
+#endif /* HAVE_SYS_SELECT_H */
+
+#ifdef HAVE_SYS_EPOLL_H
+#include <sys/epoll.h>
+#endif /* HAVE_SYS_EPOLL_H */
+
+#ifdef HAVE_SYS_TIMERFD_H
+#include <sys/timerfd.h>
+#endif /* HAVE_SYS_TIMERFD_H */
+
+#include "event_loop.h"
+#include "logger.h"
+
+struct event_source {
+    int fd;
+    event_handler handler;
+    void *data;
+    int enabled;
+    int ready;
+};
+
+struct event_timer {
+    /* The time the timer expires at, in milliseconds */
+    long long deadline;
+    event_handler handler;
+    void *data;
+    /* Set when the timer expired in this event_loop_run_once */
+    int due;
+};
+
+struct event_loop {
+    /* The descriptors, in the order they were added */
+    struct event_source *sources;
+    int source_count;
+    int source_size;
+
+    /* The pending timers, in no particular order */
+    struct event_timer *timers;
+    int timer_count;
+    int timer_size;
+
+    /* The epoll descriptor, or -1 to use select */
+    int epoll_fd;
+    /* The timerfd armed for the earliest timer, or -1 to use a timeout */
+    int timer_fd;
+};
+
+long long event_loop_now(void)
+{
+#ifdef CLOCK_MONOTONIC
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (long long) now.tv_sec * 1000 + now.tv_nsec / 1000000;
+#else
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+
+    return (long long) now.tv_sec * 1000 + now.tv_usec / 1000;
+#endif /* CLOCK_MONOTONIC */
+}
+
+static struct event_source *event_loop_find(struct event_loop *loop, int fd)
+{
+    int i;
+
+    for (i = 0; i < loop->source_count; i++) {
+        if (loop->sources[i].fd == fd)
+            return &loop->sources[i];
+    }
+
+    return NULL;
+}
+
+#ifdef HAVE_SYS_EPOLL_H
+static int event_loop_epoll_ctl(struct event_loop *loop, int op, int fd)
+{
+    struct epoll_event event;
+
+    memset(&event, 0, sizeof (event));
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+
+    if (epoll_ctl(loop->epoll_fd, op, fd, &event) == -1) {
+        logger_write_pos(logger, __FILE__, __LINE__, "epoll_ctl failed");
+        return -1;
+    }
+
+    return 0;
+}
+#endif /* HAVE_SYS_EPOLL_H */
+
+struct event_loop *event_loop_create(void)
+{
+    struct event_loop *loop;
+
+    loop = (struct event_loop *) malloc(sizeof (struct event_loop));
+    if (!loop)
+        return NULL;
+
+    memset(loop, 0, sizeof (struct event_loop));
+    loop->epoll_fd = -1;
+    loop->timer_fd = -1;
+
+#ifdef HAVE_SYS_EPOLL_H
+    loop->epoll_fd = epoll_create(16);
+    if (loop->epoll_fd == -1)
+        logger_write_pos(logger, __FILE__, __LINE__,
+                "epoll_create failed, using select");
+
+#ifdef HAVE_SYS_TIMERFD_H
+    if (loop->epoll_fd != -1) {
+        loop->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+        if (loop->timer_fd != -1 &&
+                event_loop_epoll_ctl(loop, EPOLL_CTL_ADD, loop->timer_fd)) {
+            close(loop->timer_fd);
+            loop->timer_fd = -1;
+        }
+    }
+#endif /* HAVE_SYS_TIMERFD_H */
+#endif /* HAVE_SYS_EPOLL_H */
+
+    return loop;
+}
+
+void event_loop_destroy(struct event_loop *loop)
+{
+    if (!loop)
+        return;
+
+    if (loop->timer_fd != -1)
+        close(loop->timer_fd);
+
+    if (loop->epoll_fd != -1)
+        close(loop->epoll_fd);
+
+    free(loop->sources);
+    free(loop->timers);
+    free(loop);
+}
+
+int event_loop_add(struct event_loop *loop, int fd,
+        event_handler handler, void *data)
+{
+    struct event_source *source;
+
+    if (!loop || fd < 0 || !handler || event_loop_find(loop, fd))
+        return -1;
+
+    if (loop->source_count == loop->source_size) {
+        int size = loop->source_size ? loop->source_size * 2 : 8;
+
+        source = (struct event_source *) realloc(loop->sources,
+                size * sizeof (struct event_source));
+        if (!source)
+            return -1;
+
+        loop->sources = source;
+        loop->source_size = size;
+    }
+
+#ifdef HAVE_SYS_EPOLL_H
+    if (loop->epoll_fd != -1 &&
+            event_loop_epoll_ctl(loop, EPOLL_CTL_ADD, fd) == -1)
+        return -1;
+#endif /* HAVE_SYS_EPOLL_H */
+
+    source = &loop->sources[loop->source_count++];
+    source->fd = fd;
+    source->handler = handler;
+    source->data = data;
+    source->enabled = 1;
+    source->ready = 0;
+
+    return 0;
+}
+
+int event_loop_remove(struct event_loop *loop, int fd)
+{
+    struct event_source *source = event_loop_find(loop, fd);
+    int i;
+
+    if (!source)
+        return -1;
+
+#ifdef HAVE_SYS_EPOLL_H
+    if (loop->epoll_fd != -1 && source->enabled)
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+#endif /* HAVE_SYS_EPOLL_H */
+
+    i = source - loop->sources;
+    memmove(source, source + 1,
+            (loop->source_count - i - 1) * sizeof (struct event_source));
+    loop->source_count--;
+
+    return 0;
+}
+
+int event_loop_enable(struct event_loop *loop, int fd, int enable)
+{
+    struct event_source *source = event_loop_find(loop, fd);
+
+    if (!source)
+        return -1;
+
+    enable = enable ? 1 : 0;
+    if (source->enabled == enable)
+        return 0;
+
+#ifdef HAVE_SYS_EPOLL_H
+    if (loop->epoll_fd != -1 && event_loop_epoll_ctl(loop,
+                    enable ? EPOLL_CTL_ADD : EPOLL_CTL_DEL, fd) == -1)
+        return -1;
+#endif /* HAVE_SYS_EPOLL_H */
+
+    source->enabled = enable;
+    if (!enable)
+        source->ready = 0;
+
+    return 0;
+}
+
+int event_loop_set_timer(struct event_loop *loop, int ms,
+        event_handler handler, void *data)
+{
+    struct event_timer *timer = NULL;
+    int i;
+
+    if (!loop || !handler)
+        return -1;
+
+    for (i = 0; i < loop->timer_count; i++) {
+        if (loop->timers[i].handler == handler &&
+                loop->timers[i].data == data) {
+            timer = &loop->timers[i];
+            break;
+        }
+    }
+
+    if (ms < 0) {
+        if (timer)
+            *timer = loop->timers[--loop->timer_count];
+        return 0;
+    }
+
+    if (!timer) {
+        if (loop->timer_count == loop->timer_size) {
+            int size = loop->timer_size ? loop->timer_size * 2 : 4;
+
+            timer = (struct event_timer *) realloc(loop->timers,
+                    size * sizeof (struct event_timer));
+            if (!timer)
+                return -1;
+
+            loop->timers = timer;
+            loop->timer_size = size;
+        }
+
+        timer = &loop->timers[loop->timer_count++];
+        timer->handler = handler;
+        timer->data = data;
+    }
+
+    timer->deadline = event_loop_now() + ms;
+    timer->due = 0;
+
+    return 0;
+}
+
+/* event_loop_timeout: The time until the earliest timer expires.
+ * -------------------
+ *
+ *   now:  The current time in milliseconds
+ *
+ * Return Value: The milliseconds to wait, or -1 if there are no timers.
+ */
+static int event_loop_timeout(struct event_loop *loop, long long now)
+{
+    long long timeout = -1;
+    int i;
+
+    for (i = 0; i < loop->timer_count; i++) {
+        long long left = loop->timers[i].deadline - now;
+
+        if (left < 0)
+            left = 0;
+        if (timeout == -1 || left < timeout)
+            timeout = left;
+    }
+
+    return (int) timeout;
+}
+
+#ifdef HAVE_SYS_EPOLL_H
+static int event_loop_wait_epoll(struct event_loop *loop, int timeout)
+{
+    struct epoll_event events[16];
+    int count, i;
+
+#ifdef HAVE_SYS_TIMERFD_H
+    if (loop->timer_fd != -1) {
+        struct itimerspec spec;
+
+        memset(&spec, 0, sizeof (spec));
+        if (timeout == 0)
+            spec.it_value.tv_nsec = 1;  /* A zero it_value disarms */
+        else if (timeout > 0) {
+            spec.it_value.tv_sec = timeout / 1000;
+            spec.it_value.tv_nsec = (timeout % 1000) * 1000000;
+        }
+
+        if (timerfd_settime(loop->timer_fd, 0, &spec, NULL) == -1) {
+            logger_write_pos(logger, __FILE__, __LINE__,
+                    "timerfd_settime failed");
+            return -1;
+        }
+
+        timeout = -1;
+    }
+#endif /* HAVE_SYS_TIMERFD_H */
+
+    count = epoll_wait(loop->epoll_fd, events,
+            sizeof (events) / sizeof (events[0]), timeout);
+    if (count == -1) {
+        if (errno == EINTR)
+            return 0;
+
+        logger_write_pos(logger, __FILE__, __LINE__, "epoll_wait failed");
+        return -1;
+    }
+
+    for (i = 0; i < count; i++) {
+        struct event_source *source;
+
+        if (events[i].data.fd == loop->timer_fd) {
+            unsigned long long expirations;
+
+            /* Only clears the timerfd, the timers are checked by time */
+            if (read(loop->timer_fd, &expirations,
+                    sizeof (expirations)) == -1 && errno != EAGAIN)
+                return -1;
+            continue;
+        }
+
+        source = event_loop_find(loop, events[i].data.fd);
+        if (source && source->enabled)
+            source->ready = 1;
+    }
+
+    return 0;
+}
+#endif /* HAVE_SYS_EPOLL_H */
+
+static int event_loop_wait_select(struct event_loop *loop, int timeout)
+{
+    fd_set rset;
+    struct timeval tv, *tvp = NULL;
+    int max = -1, i;
+
+    FD_ZERO(&rset);
+    for (i = 0; i < loop->source_count; i++) {
+        if (loop->sources[i].enabled) {
+            FD_SET(loop->sources[i].fd, &rset);
+            if (loop->sources[i].fd > max)
+                max = loop->sources[i].fd;
+        }
+    }
+
+    if (timeout >= 0) {
+        tv.tv_sec = timeout / 1000;
+        tv.tv_usec = (timeout % 1000) * 1000;
+        tvp = &tv;
+    }
+
+    if (select(max + 1, &rset, NULL, NULL, tvp) == -1) {
+        if (errno == EINTR)
+            return 0;
+
+        logger_write_pos(logger, __FILE__, __LINE__, "select failed");
+        return -1;
+    }
+
+    for (i = 0; i < loop->source_count; i++) {
+        if (loop->sources[i].enabled && FD_ISSET(loop->sources[i].fd, &rset))
+            loop->sources[i].ready = 1;
+    }
+
+    return 0;
+}
+
+/* event_loop_dispatch_timers: Calls the handlers of the expired timers.
+ * ---------------------------
+ *
+ * A timer set again by a handler is not called until the next run.
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+static int event_loop_dispatch_timers(struct event_loop *loop)
+{
+    long long now = event_loop_now();
+    int i;
+
+    for (i = 0; i < loop->timer_count; i++)
+        loop->timers[i].due = (loop->timers[i].deadline <= now);
+
+    for (i = 0; i < loop->timer_count; i++) {
+        if (loop->timers[i].due) {
+            event_handler handler = loop->timers[i].handler;
+            void *data = loop->timers[i].data;
+
+            loop->timers[i] = loop->timers[--loop->timer_count];
+
+            if (handler(-1, data) == -1)
+                return -1;
+
+            /* The handler may have changed the timers */
+            i = -1;
+        }
+    }
+
+    return 0;
+}
+
+/* event_loop_dispatch_sources: Calls the handlers of the ready descriptors.
+ * ----------------------------
+ *
+ * The handlers may add or remove descriptors, so the ready flag is looked
+ * up again after each call.
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+static int event_loop_dispatch_sources(struct event_loop *loop)
+{
+    int i, result;
+
+    for (i = 0; i < loop->source_count; i++) {
+        if (loop->sources[i].ready) {
+            event_handler handler = loop->sources[i].handler;
+            void *data = loop->sources[i].data;
+            int fd = loop->sources[i].fd;
+
+            loop->sources[i].ready = 0;
+
+            result = handler(fd, data);
+            if (result == -1)
+                return -1;
+
+            if (result > 0) {
+                for (i = 0; i < loop->source_count; i++)
+                    loop->sources[i].ready = 0;
+                break;
+            }
+
+            i = -1;
+        }
+    }
+
+    return 0;
+}
+
+int event_loop_run_once(struct event_loop *loop)
+{
+    int timeout, result;
+
+    if (!loop)
+        return -1;
+
+    timeout = event_loop_timeout(loop, event_loop_now());
+
+#ifdef HAVE_SYS_EPOLL_H
+    if (loop->epoll_fd != -1)
+        result = event_loop_wait_epoll(loop, timeout);
+    else
+#endif /* HAVE_SYS_EPOLL_H */
+        result = event_loop_wait_select(loop, timeout);
+
+    if (result == -1)
+        return -1;
+
+    if (event_loop_dispatch_timers(loop) == -1)
+        return -1;
+
+    return event_loop_dispatch_sources(loop);
+}
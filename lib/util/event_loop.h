@@ -0,0 +1,105 @@
+#ifndef __EVENT_LOOP_H__
+#define __EVENT_LOOP_H__
+
+/* event_loop:
+ * -----------
+ *
+ * Waits for input on a set of file descriptors, and for timers to expire,
+ * and calls the handler registered for each one. It uses epoll and timerfd
+ * when they are available, and select otherwise.
+ */
+
+struct event_loop;
+
+/* event_handler: Called when a descriptor has input, or a timer expired.
+ * --------------
+ *
+ *   fd:    The descriptor with input, or -1 for a timer
+ *   data:  The data the handler was registered with
+ *
+ * Return Value: 0 on success,
+ *               1 to not call the other handlers that are ready until the
+ *                 next event_loop_run_once,
+ *               -1 on error, event_loop_run_once returns -1.
+ */
+typedef int (*event_handler) (int fd, void *data);
+
+/* event_loop_create: Creates a new event loop.
+ * ------------------
+ *
+ * Return Value: The event loop, or NULL on error.
+ */
+struct event_loop *event_loop_create(void);
+
+/* event_loop_destroy: Frees an event loop. The descriptors are not closed.
+ * -------------------
+ */
+void event_loop_destroy(struct event_loop *loop);
+
+/* event_loop_add: Calls handler whenever fd has input.
+ * ---------------
+ *
+ * When several descriptors have input, the handlers are called in the
+ * order the descriptors were added.
+ *
+ *   fd:       The descriptor to watch
+ *   handler:  The function to call
+ *   data:     Passed to handler
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+int event_loop_add(struct event_loop *loop, int fd,
+        event_handler handler, void *data);
+
+/* event_loop_remove: Stops watching fd.
+ * ------------------
+ *
+ * Return Value: 0 on success, -1 if fd is not being watched.
+ */
+int event_loop_remove(struct event_loop *loop, int fd);
+
+/* event_loop_enable: Pauses or resumes watching fd.
+ * ------------------
+ *
+ *   fd:      A descriptor that was added with event_loop_add
+ *   enable:  0 to ignore the input on fd, 1 to watch it again
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+int event_loop_enable(struct event_loop *loop, int fd, int enable);
+
+/* event_loop_set_timer: Calls handler once, after a number of milliseconds.
+ * ---------------------
+ *
+ * A timer is known by its handler and data. Setting it again replaces the
+ * time it will expire at.
+ *
+ *   ms:       Milliseconds from now, or -1 to cancel the timer
+ *   handler:  The function to call, with fd -1
+ *   data:     Passed to handler
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+int event_loop_set_timer(struct event_loop *loop, int ms,
+        event_handler handler, void *data);
+
+/* event_loop_now: The time timers are measured in.
+ * ---------------
+ *
+ * The clock is monotonic when the system has one, so that setting the
+ * system time does not delay or hurry the timers.
+ *
+ * Return Value: The current time in milliseconds.
+ */
+long long event_loop_now(void);
+
+/* event_loop_run_once: Waits for input or a timer, and calls the handlers.
+ * --------------------
+ *
+ * A signal interrupting the wait is not an error, nothing is called.
+ *
+ * Return Value: 0 on success, -1 on error.
+ */
+int event_loop_run_once(struct event_loop *loop);
+
+#endif /* __EVENT_LOOP_H__ */